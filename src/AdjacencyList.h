@@ -0,0 +1,295 @@
+/*
+ * AdjacencyList.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef ADJACENCYLIST_H_
+#define ADJACENCYLIST_H_
+
+#include "AdjacencyList_class.h"
+
+
+// Constructors
+
+// Empty list
+template <class T>
+AdjacencyList<T>::AdjacencyList():vertices(0),
+								  edges(0),
+								  unit(true),
+								  first(1, 0) {
+}	// end - AdjacencyList()
+
+// From the adjacency matrix
+template <class T>
+AdjacencyList<T>::AdjacencyList(Graph<T>& graph):vertices(0),
+												 edges(0),
+												 unit(true),
+												 first(1, 0) {
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	// Graph size
+	int size = graph.Vertices();
+
+	// Check for a valid size
+	if (size < 2)
+		return;
+
+	// Initialize the vertices member
+	vertices = size;
+
+	// Rows are already in tail order - fill the CSR arrays directly
+	first.assign(size + 1, 0);
+	for (int u = 0; u < size; u++) {
+		first[u] = heads.size();
+		for (int v = 0; v < size; v++) {
+			T value = graph.get_edge_value(u, v);
+			if (value != 0 && value != infinity) {
+				heads.push_back(v);
+				weights.push_back(value);
+			}
+		}
+	}
+	first[size] = heads.size();
+
+	// Initialize the edges member
+	edges = heads.size();
+
+	// Check for a unit-weight graph
+	unit = (count(weights.begin(), weights.end(), (T) 1) == edges);
+
+}	// end - AdjacencyList(Graph)
+
+// From the adjacency matrix, every edge in both directions if undirected
+template <class T>
+AdjacencyList<T>::AdjacencyList(Graph<T>& graph,
+								bool undirected):vertices(0),
+												 edges(0),
+												 unit(true),
+												 first(1, 0) {
+
+	// Directed is the plain matrix constructor
+	if (!undirected) {
+		*this = AdjacencyList<T>(graph);
+		return;
+	}
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	// Graph size
+	int size = graph.Vertices();
+
+	// Check for a valid size
+	if (size < 2)
+		return;
+
+	// Edge triples in both directions
+	vector<int> tails;
+	vector<int> heads_in;
+	vector<T> weights_in;
+
+	for (int u = 0; u < size; u++) {
+		for (int v = 0; v < size; v++) {
+			T value = graph.get_edge_value(u, v);
+			if (value == 0 || value == infinity || u == v)
+				continue;
+			tails.push_back(u);
+			heads_in.push_back(v);
+			weights_in.push_back(value);
+			tails.push_back(v);
+			heads_in.push_back(u);
+			weights_in.push_back(value);
+		}
+	}
+
+	// Initialize the vertices member
+	vertices = size;
+
+	// Build the CSR arrays
+	build(tails, heads_in, weights_in);
+
+}	// end - AdjacencyList(Graph, undirected)
+
+// From an edge file
+template <class T>
+AdjacencyList<T>::AdjacencyList(string file_name):vertices(0),
+												  edges(0),
+												  unit(true),
+												  first(1, 0) {
+
+	// graph size
+	int size = 0;
+
+	// Setup a file stream
+	ifstream data_file(file_name);
+	if (!data_file) {
+		cerr << "Couldn't open file: " << file_name << endl;
+		return;
+	}
+
+	// Define input stream iterators
+	istream_iterator<long> input(data_file);
+	istream_iterator<long> eos;
+
+	// Read in the number of vertices
+	if (input != eos)
+		size = *input++;
+
+	// Check for a valid size
+	if (size < 2)
+		return;
+
+	// Read in the number of edges
+	int count = 0;
+	if (input != eos)
+		count = *input++;
+
+	// Edge triples
+	vector<int> tails;
+	vector<int> heads_in;
+	vector<T> weights_in;
+	tails.reserve(count);
+	heads_in.reserve(count);
+	weights_in.reserve(count);
+
+	// Read in the edges
+	while (input != eos) {
+
+		// Get the graph nodes
+		int x = *input++ - 1;
+		if (input == eos)
+			break;
+		int y = *input++ - 1;
+		if (input == eos)
+			break;
+
+		// Get the edge value
+		T value = *input++;
+
+		// Check validity
+		if (x < 0 || x >= size || y < 0 || y >= size) {
+			cerr << "Invalid graph node: " << x << ":" << y << endl;
+			return;
+		}
+
+		tails.push_back(x);
+		heads_in.push_back(y);
+		weights_in.push_back(value);
+	}
+
+	// Initialize the vertices member
+	vertices = size;
+
+	// Build the CSR arrays
+	build(tails, heads_in, weights_in);
+
+}	// end - AdjacencyList(string)
+
+// Methods
+
+// Build the CSR arrays with a counting sort on the tails
+template <class T>
+void AdjacencyList<T>::build(vector<int>& tails,
+							 vector<int>& heads_in,
+							 vector<T>& weights_in) {
+
+	// Initialize the edges member
+	edges = tails.size();
+
+	// Count the edges of each tail
+	first.assign(vertices + 1, 0);
+	for (auto u : tails)
+		first[u + 1]++;
+
+	// Prefix sums give the first edge of each tail
+	for (int v = 0; v < vertices; v++)
+		first[v + 1] += first[v];
+
+	// Scatter the edges
+	heads.resize(edges);
+	weights.resize(edges);
+	vector<int> next(first.begin(), first.end() - 1);
+	for (int e = 0; e < edges; e++) {
+		int slot = next[tails[e]]++;
+		heads[slot] = heads_in[e];
+		weights[slot] = weights_in[e];
+	}
+
+	// Check for a unit-weight graph
+	unit = (count(weights.begin(), weights.end(), (T) 1) == edges);
+
+}	// end - build()
+
+// Return the u->v edge, -1 if missing
+template <class T>
+int AdjacencyList<T>::find(int u, int v) const {
+
+	// Check for a valid vertex
+	if (u < 0 || u >= vertices)
+		return -1;
+
+	for (int e = first[u]; e < first[u + 1]; e++)
+		if (heads[e] == v)
+			return e;
+
+	return -1;
+
+}	// end - find()
+
+// Set the u->v edge weight
+template <class T>
+void AdjacencyList<T>::set_edge(int u, int v, T value) {
+
+	// Check for valid vertices
+	if (u < 0 || u >= vertices || v < 0 || v >= vertices) {
+		cerr << "Invalid graph node: " << u << ":" << v << endl;
+		return;
+	}
+
+	bool remove = (value == numeric_limits<T>::max());
+	int edge = find(u, v);
+
+	// Nothing to remove
+	if (remove && edge < 0)
+		return;
+
+	// Existing edge - update in place
+	if (!remove && edge >= 0) {
+		weights[edge] = value;
+		unit = (count(weights.begin(), weights.end(), (T) 1) == edges);
+		return;
+	}
+
+	// Collect the edge triples without the u->v edge
+	vector<int> tails;
+	vector<int> heads_in;
+	vector<T> weights_in;
+	tails.reserve(edges + 1);
+	heads_in.reserve(edges + 1);
+	weights_in.reserve(edges + 1);
+
+	for (int x = 0; x < vertices; x++)
+		for (int e = first[x]; e < first[x + 1]; e++)
+			if (e != edge) {
+				tails.push_back(x);
+				heads_in.push_back(heads[e]);
+				weights_in.push_back(weights[e]);
+			}
+
+	// Add the new edge
+	if (!remove) {
+		tails.push_back(u);
+		heads_in.push_back(v);
+		weights_in.push_back(value);
+	}
+
+	// Rebuild the CSR arrays
+	build(tails, heads_in, weights_in);
+
+}	// end - set_edge()
+
+#endif /* ADJACENCYLIST_H_ */
@@ -0,0 +1,104 @@
+/*
+ * AdjacencyList_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef ADJACENCYLIST_CLASS_H_
+#define ADJACENCYLIST_CLASS_H_
+
+#include <vector>
+
+using namespace std;
+
+#include "Graph.h"
+
+
+// Compressed sparse row (CSR) adjacency list
+// Edges of vertex v are [out_begin(v), out_end(v))
+template <class T>
+class AdjacencyList {
+
+private:
+
+	// Number of vertices
+	int vertices;
+
+	// Number of edges
+	int edges;
+
+	// True if every edge weight is 1
+	bool unit;
+
+	// First edge of each vertex, size vertices + 1
+	vector<int> first;
+
+	// Edge heads
+	vector<int> heads;
+
+	// Edge weights
+	vector<T> weights;
+
+	// Build the CSR arrays from tail, head, weight triples
+	void build(vector<int>&, vector<int>&, vector<T>&);
+
+public:
+
+	// Empty list
+	AdjacencyList();
+
+	// From the adjacency matrix - 0 and infinity are missing edges
+	AdjacencyList(Graph<T>&);
+
+	// Undirected - every matrix edge in both directions
+	AdjacencyList(Graph<T>&, bool);
+
+	// From an edge file - "vertices edges" then 1-based "tail head weight"
+	AdjacencyList(string);
+
+	// Return the number of vertices
+	int Vertices() const {
+		return vertices;
+	}
+
+	// Return the number of edges
+	int Edges() const {
+		return edges;
+	}
+
+	// First edge of a vertex
+	int out_begin(int v) const {
+		return first[v];
+	}
+
+	// One past the last edge of a vertex
+	int out_end(int v) const {
+		return first[v + 1];
+	}
+
+	// Head of an edge
+	int head(int e) const {
+		return heads[e];
+	}
+
+	// Weight of an edge
+	T weight(int e) const {
+		return weights[e];
+	}
+
+	// Return true if every edge weight is 1
+	bool unit_weight() const {
+		return unit;
+	}
+
+	// Return the u->v edge, -1 if missing
+	int find(int, int) const;
+
+	// Set the u->v edge weight, numeric_limits<T>::max() removes it
+	// In place for an existing edge, else O(V+E) rebuild
+	void set_edge(int, int, T);
+
+};	// end - AdjacencyList class
+
+#endif /* ADJACENCYLIST_CLASS_H_ */
@@ -0,0 +1,204 @@
+/*
+ * BFS.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef BFS_H_
+#define BFS_H_
+
+#include "BFS_class.h"
+
+
+// Search the specified graph
+template <class T>
+BFS<T>::BFS(const AdjacencyList<T>& graph):graph(graph) {
+
+	// Allocate the bitmaps once - the multi-source words on first use
+	int words = (graph.Vertices() + 63) / 64;
+	visited_map.assign(words, 0);
+	frontier_map.assign(words, 0);
+	next_map.assign(words, 0);
+
+}	// end - BFS(AdjacencyList)
+
+// Level-synchronous BFS from up to 64 sources at once
+template <class T>
+template <class Visit>
+void BFS<T>::multi_source(const int* sources, int count, Visit visit) {
+
+	// Reset the scratch buffers
+	if (seen.size() != (size_t) graph.Vertices()) {
+		seen.assign(graph.Vertices(), 0);
+		frontier.assign(graph.Vertices(), 0);
+		next.assign(graph.Vertices(), 0);
+	}
+	fill(seen.begin(), seen.end(), 0);
+	fill(frontier.begin(), frontier.end(), 0);
+	active.clear();
+
+	// Seed one bit per source
+	for (int b = 0; b < count && b < 64; b++) {
+
+		int v = sources[b];
+		uint64_t bit = (uint64_t) 1 << b;
+
+		if (frontier[v] == 0)
+			active.push_back(v);
+		seen[v] |= bit;
+		frontier[v] |= bit;
+	}
+
+	// Level 0 - the sources themselves
+	for (auto v : active)
+		visit(v, frontier[v], 0);
+
+	// Expand one level at a time
+	for (int level = 1; !active.empty(); level++) {
+
+		next_active.clear();
+
+		// Push every frontier word along the edges
+		for (auto u : active) {
+
+			uint64_t bits = frontier[u];
+			frontier[u] = 0;
+
+			for (int e = graph.out_begin(u); e < graph.out_end(u); e++) {
+
+				int w = graph.head(e);
+
+				// Sources that haven't reached w yet
+				uint64_t fresh = bits & ~seen[w];
+				if (fresh == 0)
+					continue;
+
+				if (next[w] == 0)
+					next_active.push_back(w);
+				next[w] |= fresh;
+			}
+		}
+
+		// The new frontier
+		for (auto w : next_active) {
+
+			uint64_t fresh = next[w];
+			next[w] = 0;
+
+			seen[w] |= fresh;
+			frontier[w] = fresh;
+
+			visit(w, fresh, level);
+		}
+
+		active.swap(next_active);
+	}
+
+}	// end - multi_source()
+
+// Level-synchronous BFS from one source over the bitmaps
+template <class T>
+template <class Visit>
+bool BFS<T>::single_source(int source, int target, Visit visit) {
+
+	// Reset the bitmaps - V / 64 words
+	fill(visited_map.begin(), visited_map.end(), 0);
+	fill(frontier_map.begin(), frontier_map.end(), 0);
+
+	// Seed the source
+	uint64_t bit = (uint64_t) 1 << (source & 63);
+	visited_map[source >> 6] |= bit;
+	frontier_map[source >> 6] |= bit;
+
+	visit(source, -1, 0);
+	if (source == target)
+		return true;
+
+	// Expand one level at a time
+	bool more = true;
+	for (int level = 1; more; level++) {
+
+		more = false;
+		fill(next_map.begin(), next_map.end(), 0);
+
+		// Scan the frontier in vertex order
+		for (size_t w = 0; w < frontier_map.size(); w++) {
+
+			uint64_t word = frontier_map[w];
+			while (word != 0) {
+
+				int u = (w << 6) + __builtin_ctzll(word);
+				word &= word - 1;
+
+				for (int e = graph.out_begin(u); e < graph.out_end(u); e++) {
+
+					int x = graph.head(e);
+					uint64_t bit = (uint64_t) 1 << (x & 63);
+
+					// Skip reached vertices
+					if (visited_map[x >> 6] & bit)
+						continue;
+
+					visited_map[x >> 6] |= bit;
+					next_map[x >> 6] |= bit;
+					more = true;
+
+					visit(x, u, level);
+					if (x == target)
+						return true;
+				}
+			}
+		}
+
+		frontier_map.swap(next_map);
+	}
+
+	return false;
+
+}	// end - single_source()
+
+// One-to-all hop counts from source
+template <class T>
+void BFS<T>::run(int source, T* row) {
+
+	fill(row, row + graph.Vertices(), numeric_limits<T>::max());
+
+	single_source(source, -1, [&](int v, int parent, int hops) {
+		row[v] = hops;
+	});
+
+}	// end - run(row)
+
+// One-to-all hop counts and BFS tree from source
+template <class T>
+void BFS<T>::run(int source, SSSPTree<T>& tree) {
+
+	tree.assign(source, graph.Vertices());
+
+	T* dist = tree.distances();
+	int* pred = tree.predecessors();
+
+	single_source(source, -1, [&](int v, int parent, int hops) {
+		dist[v] = hops;
+		pred[v] = parent;
+	});
+
+}	// end - run(tree)
+
+// Source -> target hop count
+template <class T>
+T BFS<T>::distance(int source, int target) {
+
+	T result = numeric_limits<T>::max();
+
+	single_source(source, target, [&](int v, int parent, int hops) {
+		if (v == target)
+			result = hops;
+	});
+
+	return result;
+
+}	// end - distance()
+
+#endif /* BFS_H_ */
@@ -0,0 +1,73 @@
+/*
+ * BFS_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef BFS_CLASS_H_
+#define BFS_CLASS_H_
+
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+#include "AdjacencyList.h"
+#include "SSSPTree.h"
+
+
+// Breadth-first search engine for unit-weight graphs
+// One instance per thread - the scratch buffers are reused between runs
+template <class T>
+class BFS {
+
+private:
+
+	// The graph
+	const AdjacencyList<T>& graph;
+
+	// Bit-parallel state - bit b of a word belongs to source b
+	vector<uint64_t> seen;
+	vector<uint64_t> frontier;
+	vector<uint64_t> next;
+
+	// Vertices with a non-empty frontier word
+	vector<int> active;
+	vector<int> next_active;
+
+	// Single-source bitmaps - bit v % 64 of word v / 64
+	vector<uint64_t> visited_map;
+	vector<uint64_t> frontier_map;
+	vector<uint64_t> next_map;
+
+	// Level-synchronous BFS from one source over the bitmaps
+	// visit(vertex, parent, hops) once per reached vertex
+	// Returns true as soon as target is reached
+	template <class Visit>
+	bool single_source(int, int, Visit);
+
+public:
+
+	// Search the specified graph
+	BFS(const AdjacencyList<T>&);
+
+	// Level-synchronous BFS from up to 64 sources at once
+	// visit(vertex, source bits, hops) is called once per vertex and level
+	// with the sources that first reach the vertex at that level
+	template <class Visit>
+	void multi_source(const int*, int, Visit);
+
+	// One-to-all hop counts from source into row[0..V)
+	// Unreachable vertices are numeric_limits<T>::max()
+	void run(int, T*);
+
+	// One-to-all hop counts and BFS tree from source
+	void run(int, SSSPTree<T>&);
+
+	// Source -> target hop count, stops when the target is reached
+	T distance(int, int);
+
+};	// end - BFS class
+
+#endif /* BFS_CLASS_H_ */
@@ -0,0 +1,79 @@
+/*
+ * BellmanFord.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef BELLMANFORD_H_
+#define BELLMANFORD_H_
+
+#include "BellmanFord_class.h"
+
+
+// Constructor
+template <class T>
+BellmanFord<T>::BellmanFord(const AdjacencyList<T>& graph):graph(graph) {
+}
+
+// Compute the potentials
+template <class T>
+string BellmanFord<T>::getPotentials() {
+
+	// Graph size
+	int size = graph.Vertices();
+
+	// The virtual source reaches every vertex at distance 0
+	potentials.assign(size, 0);
+	passes.assign(size, 1);
+	queued.assign(size, true);
+
+	// Every vertex starts in the queue
+	deque<int> queue;
+	for (int v = 0; v < size; v++)
+		queue.push_back(v);
+
+	// Relax until nothing changes
+	while (!queue.empty()) {
+
+		int u = queue.front();
+		queue.pop_front();
+		queued[u] = false;
+
+		T du = potentials[u];
+
+		// Relax the outgoing edges
+		for (int e = graph.out_begin(u); e < graph.out_end(u); e++) {
+
+			int v = graph.head(e);
+			T next = du + graph.weight(e);
+
+			if (next < potentials[v]) {
+				potentials[v] = next;
+
+				// Queue it if necessary
+				if (!queued[v]) {
+
+					// A vertex queued more than V times is on a negative cycle
+					if (++passes[v] > size)
+						return "NULL";
+
+					queued[v] = true;
+					queue.push_back(v);
+				}
+			}
+		}
+	}
+
+	// Return OK
+	return "OK";
+
+}	// end - getPotentials()
+
+// Return the potentials
+template <class T>
+vector<T>& BellmanFord<T>::Potentials() {
+	return potentials;
+}
+
+#endif /* BELLMANFORD_H_ */
@@ -0,0 +1,52 @@
+/*
+ * BellmanFord_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef BELLMANFORD_CLASS_H_
+#define BELLMANFORD_CLASS_H_
+
+#include <vector>
+#include <deque>
+
+using namespace std;
+
+#include "AdjacencyList.h"
+
+
+// Queue-based Bellman-Ford (SPFA) for Johnson reweighting potentials
+// Runs from a virtual source with 0-weight edges to every vertex
+template <class T>
+class BellmanFord {
+
+private:
+
+	// The graph
+	const AdjacencyList<T>& graph;
+
+	// Vertex potentials h(v) = d(virtual source, v)
+	vector<T> potentials;
+
+	// Number of times each vertex entered the queue
+	vector<int> passes;
+
+	// Queued vertex flags
+	vector<bool> queued;
+
+public:
+
+	// Potentials of the specified graph
+	BellmanFord(const AdjacencyList<T>&);
+
+	// Compute the potentials
+	// Returns "NULL" for a negative-cost cycle, else "OK"
+	string getPotentials();
+
+	// Return the potentials
+	vector<T>& Potentials();
+
+};	// end - BellmanFord class
+
+#endif /* BELLMANFORD_CLASS_H_ */
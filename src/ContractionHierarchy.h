@@ -0,0 +1,867 @@
+/*
+ * ContractionHierarchy.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef CONTRACTIONHIERARCHY_H_
+#define CONTRACTIONHIERARCHY_H_
+
+#include "ContractionHierarchy_class.h"
+
+
+// Constructors
+
+// Empty hierarchy
+template <class T>
+ContractionHierarchy<T>::ContractionHierarchy():vertices(0),
+												shortcuts(0),
+												meeting_node(-1),
+												witness_settle_limit(500) {
+}	// end - ContractionHierarchy()
+
+// Preprocess the specified graph
+template <class T>
+ContractionHierarchy<T>::ContractionHierarchy(Graph<T>& graph):
+												vertices(0),
+												shortcuts(0),
+												meeting_node(-1),
+												witness_settle_limit(500) {
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	// Graph size
+	int size = graph.Vertices();
+
+	// Check for a valid size
+	if (size < 2)
+		return;
+
+	// Working adjacency lists - in[v] holds u->v edges with to = u
+	vector< vector<CHEdge> > out(size);
+	vector< vector<CHEdge> > in(size);
+
+	// Read the edges from the adjacency matrix
+	for (int u = 0; u < size; u++) {
+		for (int v = 0; v < size; v++) {
+
+			T weight = graph.get_edge_value(u, v);
+
+			// Skip missing edges and self loops
+			if (weight == 0 || weight == infinity || u == v)
+				continue;
+
+			// Contraction requires non-negative weights
+			if (weight < 0) {
+				cerr << "Negative edge weight: " << u << ":" << v << endl;
+				return;
+			}
+
+			out[u].push_back(CHEdge{v, weight, -1});
+			in[v].push_back(CHEdge{u, weight, -1});
+		}
+	}
+
+	// Initialize the vertices member
+	vertices = size;
+
+	// Contract the vertices and build the search graph
+	contract(out, in);
+	build_search_graph(out, in);
+
+}	// end - ContractionHierarchy(Graph)
+
+// Methods
+
+// Return the number of vertices
+template <class T>
+int ContractionHierarchy<T>::Vertices() {
+	return vertices;
+}
+
+// Return the number of shortcuts
+template <class T>
+int ContractionHierarchy<T>::Shortcuts() {
+	return shortcuts;
+}
+
+// Return the contraction rank of a vertex
+template <class T>
+int ContractionHierarchy<T>::get_rank(int v) {
+
+	// Check for a valid vertex
+	if (v < 0 || v >= vertices)
+		return -1;
+
+	return rank[v];
+}
+
+// Contract every vertex in edge-difference order
+template <class T>
+void ContractionHierarchy<T>::contract(vector< vector<CHEdge> >& out,
+									   vector< vector<CHEdge> >& in) {
+
+	// Contracted vertex flags
+	vector<bool> contracted(vertices, false);
+
+	// Number of contracted neighbors of each vertex
+	vector<int> deleted(vertices, 0);
+
+	// Allocate the witness search state
+	witness_dist.assign(vertices, numeric_limits<T>::max());
+	witness_touched.clear();
+
+	// Allocate the rank list
+	rank.assign(vertices, -1);
+
+	// Edge difference plus deleted neighbors
+	auto priority = [&](int v) {
+
+		// Count the remaining edges of the vertex
+		int degree = 0;
+		for (auto &e : in[v])
+			if (!contracted[e.to])
+				degree++;
+		for (auto &e : out[v])
+			if (!contracted[e.to])
+				degree++;
+
+		return contract_node(out, in, contracted, v, false)
+				- degree + deleted[v];
+	};
+
+	// Min-queue of (priority, vertex)
+	priority_queue< pair<int, int>,
+					vector< pair<int, int> >,
+					greater< pair<int, int> > > queue;
+
+	// Initial ordering
+	for (int v = 0; v < vertices; v++)
+		queue.push(make_pair(priority(v), v));
+
+	// Contraction order
+	int order = 0;
+
+	// Lazily updated contraction loop
+	while (!queue.empty()) {
+
+		int v = queue.top().second;
+		queue.pop();
+
+		// Recompute the priority - requeue if it got worse
+		int current = priority(v);
+		if (!queue.empty() && current > queue.top().first) {
+			queue.push(make_pair(current, v));
+			continue;
+		}
+
+		// Add the shortcuts and contract the vertex
+		contract_node(out, in, contracted, v, true);
+		contracted[v] = true;
+		rank[v] = order++;
+
+		// Update the neighbors' deleted counts
+		for (auto &e : in[v])
+			if (!contracted[e.to])
+				deleted[e.to]++;
+		for (auto &e : out[v])
+			if (!contracted[e.to])
+				deleted[e.to]++;
+	}
+
+	// Release the witness search state
+	witness_dist.clear();
+	witness_touched.clear();
+
+}	// end - contract()
+
+// Count (or add) the shortcuts needed to contract vertex v
+template <class T>
+int ContractionHierarchy<T>::contract_node(vector< vector<CHEdge> >& out,
+										   vector< vector<CHEdge> >& in,
+										   vector<bool>& contracted,
+										   int v,
+										   bool add) {
+
+	// Number of shortcuts
+	int count = 0;
+
+	// Largest remaining outgoing weight
+	T max_out = 0;
+	bool has_out = false;
+	for (auto &e : out[v]) {
+		if (!contracted[e.to] && e.weight > max_out)
+			max_out = e.weight;
+		if (!contracted[e.to])
+			has_out = true;
+	}
+
+	// Nothing to bypass
+	if (!has_out)
+		return 0;
+
+	// Loop through the incoming edges
+	// Index based - add_shortcut() may grow in[]
+	for (size_t i = 0; i < in[v].size(); i++) {
+
+		int u = in[v][i].to;
+		T w_in = in[v][i].weight;
+
+		// Skip contracted tails
+		if (contracted[u])
+			continue;
+
+		// Search for witnesses not passing through v
+		witness_search(out, contracted, u, v, w_in + max_out);
+
+		// Check every outgoing edge
+		for (size_t j = 0; j < out[v].size(); j++) {
+
+			int x = out[v][j].to;
+
+			// Skip contracted heads and u->v->u
+			if (contracted[x] || x == u)
+				continue;
+
+			// Path through v
+			T via = w_in + out[v][j].weight;
+
+			// A witness path is at least as short
+			if (witness_dist[x] <= via)
+				continue;
+
+			count++;
+
+			// Add the shortcut
+			if (add)
+				add_shortcut(out, in, u, x, via, v);
+		}
+	}
+
+	return count;
+
+}	// end - contract_node()
+
+// Bounded Dijkstra from source avoiding the contracted vertex
+template <class T>
+void ContractionHierarchy<T>::witness_search(vector< vector<CHEdge> >& out,
+											 vector<bool>& contracted,
+											 int source,
+											 int avoid,
+											 T limit) {
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	// Reset the previous search
+	for (auto v : witness_touched)
+		witness_dist[v] = infinity;
+	witness_touched.clear();
+
+	// Min-queue of (distance, vertex)
+	priority_queue< pair<T, int>,
+					vector< pair<T, int> >,
+					greater< pair<T, int> > > queue;
+
+	witness_dist[source] = 0;
+	witness_touched.push_back(source);
+	queue.push(make_pair((T) 0, source));
+
+	// Number of settled vertices
+	int settled = 0;
+
+	while (!queue.empty()) {
+
+		T dist = queue.top().first;
+		int u = queue.top().second;
+		queue.pop();
+
+		// Skip stale entries
+		if (dist > witness_dist[u])
+			continue;
+
+		// Stop past the limits
+		if (dist > limit || ++settled > witness_settle_limit)
+			break;
+
+		// Relax the remaining edges
+		for (auto &e : out[u]) {
+
+			if (contracted[e.to] || e.to == avoid)
+				continue;
+
+			T next = dist + e.weight;
+			if (next < witness_dist[e.to]) {
+				if (witness_dist[e.to] == infinity)
+					witness_touched.push_back(e.to);
+				witness_dist[e.to] = next;
+				queue.push(make_pair(next, e.to));
+			}
+		}
+	}
+
+}	// end - witness_search()
+
+// Add the u->x shortcut, or lower an existing u->x edge
+template <class T>
+void ContractionHierarchy<T>::add_shortcut(vector< vector<CHEdge> >& out,
+										   vector< vector<CHEdge> >& in,
+										   int u,
+										   int x,
+										   T weight,
+										   int middle) {
+
+	// Look for an existing edge
+	for (auto &e : out[u]) {
+		if (e.to == x) {
+
+			// Keep the shorter edge
+			if (weight < e.weight) {
+				e.weight = weight;
+				e.middle = middle;
+				for (auto &r : in[x]) {
+					if (r.to == u) {
+						r.weight = weight;
+						r.middle = middle;
+					}
+				}
+			}
+			return;
+		}
+	}
+
+	// Add a new shortcut
+	out[u].push_back(CHEdge{x, weight, middle});
+	in[x].push_back(CHEdge{u, weight, middle});
+
+	shortcuts++;
+
+}	// end - add_shortcut()
+
+// Build the upward and downward search graphs
+template <class T>
+void ContractionHierarchy<T>::build_search_graph(vector< vector<CHEdge> >& out,
+												 vector< vector<CHEdge> >& in) {
+
+	up_first.assign(vertices + 1, 0);
+	down_first.assign(vertices + 1, 0);
+	up_edges.clear();
+	down_edges.clear();
+
+	for (int v = 0; v < vertices; v++) {
+
+		// Upward edges v->w
+		up_first[v] = up_edges.size();
+		for (auto &e : out[v])
+			if (rank[e.to] > rank[v])
+				up_edges.push_back(e);
+
+		// Downward edges u->v
+		down_first[v] = down_edges.size();
+		for (auto &e : in[v])
+			if (rank[e.to] > rank[v])
+				down_edges.push_back(e);
+	}
+
+	// Close the last ranges
+	up_first[vertices] = up_edges.size();
+	down_first[vertices] = down_edges.size();
+
+	// Allocate the query state
+	fwd_dist.assign(vertices, numeric_limits<T>::max());
+	bwd_dist.assign(vertices, numeric_limits<T>::max());
+	fwd_parent.assign(vertices, -1);
+	bwd_parent.assign(vertices, -1);
+	fwd_middle.assign(vertices, -1);
+	bwd_middle.assign(vertices, -1);
+	touched.clear();
+
+}	// end - build_search_graph()
+
+// Reset the query search state
+template <class T>
+void ContractionHierarchy<T>::reset_query() {
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	// Only the vertices reached by the last query
+	for (auto v : touched) {
+		fwd_dist[v] = infinity;
+		bwd_dist[v] = infinity;
+		fwd_parent[v] = -1;
+		bwd_parent[v] = -1;
+	}
+	touched.clear();
+
+	meeting_node = -1;
+}
+
+// Bidirectional upward Dijkstra
+template <class T>
+T ContractionHierarchy<T>::query(int source, int target) {
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	// Check for valid vertices
+	if (source < 0 || source >= vertices || target < 0 || target >= vertices)
+		return infinity;
+
+	reset_query();
+
+	// Check for same node
+	if (source == target) {
+		meeting_node = source;
+		return 0;
+	}
+
+	// Min-queues of (distance, vertex)
+	typedef priority_queue< pair<T, int>,
+							vector< pair<T, int> >,
+							greater< pair<T, int> > > queue_t;
+	queue_t fwd_queue;
+	queue_t bwd_queue;
+
+	// Seed both searches
+	fwd_dist[source] = 0;
+	bwd_dist[target] = 0;
+	touched.push_back(source);
+	touched.push_back(target);
+	fwd_queue.push(make_pair((T) 0, source));
+	bwd_queue.push(make_pair((T) 0, target));
+
+	// Best meeting distance
+	T best = infinity;
+
+	while (!fwd_queue.empty() || !bwd_queue.empty()) {
+
+		// A direction is done once its minimum can't improve the best
+		if (!fwd_queue.empty() && fwd_queue.top().first >= best)
+			fwd_queue = queue_t();
+		if (!bwd_queue.empty() && bwd_queue.top().first >= best)
+			bwd_queue = queue_t();
+
+		// Pick the direction with the smaller minimum
+		bool forward;
+		if (fwd_queue.empty() && bwd_queue.empty())
+			break;
+		else if (fwd_queue.empty())
+			forward = false;
+		else if (bwd_queue.empty())
+			forward = true;
+		else
+			forward = fwd_queue.top().first <= bwd_queue.top().first;
+
+		// Search state of this direction
+		queue_t& queue = forward ? fwd_queue : bwd_queue;
+		vector<T>& dist = forward ? fwd_dist : bwd_dist;
+		vector<T>& other = forward ? bwd_dist : fwd_dist;
+		vector<int>& parent = forward ? fwd_parent : bwd_parent;
+		vector<int>& middle = forward ? fwd_middle : bwd_middle;
+		vector<int>& first = forward ? up_first : down_first;
+		vector<CHEdge>& edges = forward ? up_edges : down_edges;
+
+		T d = queue.top().first;
+		int u = queue.top().second;
+		queue.pop();
+
+		// Skip stale entries
+		if (d > dist[u])
+			continue;
+
+		// Check for a better meeting point
+		if (other[u] != infinity && d + other[u] < best) {
+			best = d + other[u];
+			meeting_node = u;
+		}
+
+		// Relax the upward edges
+		for (int i = first[u]; i < first[u + 1]; i++) {
+
+			int v = edges[i].to;
+			T next = d + edges[i].weight;
+
+			if (next < dist[v]) {
+				if (fwd_dist[v] == infinity && bwd_dist[v] == infinity)
+					touched.push_back(v);
+				dist[v] = next;
+				parent[v] = u;
+				middle[v] = edges[i].middle;
+				queue.push(make_pair(next, v));
+			}
+		}
+	}
+
+	return best;
+
+}	// end - query()
+
+// Shortest path of original vertices
+template <class T>
+list<int> ContractionHierarchy<T>::query_path(int source, int target) {
+
+	// The path node list
+	list<int> path;
+
+	// Run the query
+	if (query(source, target) == numeric_limits<T>::max())
+		return path;
+
+	// Forward chain from the meeting node back to the source
+	vector<int> chain;
+	for (int v = meeting_node; v != source; v = fwd_parent[v])
+		chain.push_back(v);
+
+	// Unpack the source side
+	path.push_back(source);
+	int u = source;
+	for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+		unpack_edge(u, *it, fwd_middle[*it], path);
+		u = *it;
+	}
+
+	// Unpack the target side
+	for (int v = meeting_node; v != target; v = bwd_parent[v])
+		unpack_edge(v, bwd_parent[v], bwd_middle[v], path);
+
+	return path;
+
+}	// end - query_path()
+
+// Append the original vertices after a on the a->b edge
+template <class T>
+void ContractionHierarchy<T>::unpack_edge(int a, int b, int middle,
+										  list<int>& path) {
+
+	// Edges still to unpack - (from, to, middle)
+	vector< pair<int, pair<int, int> > > stack;
+	stack.push_back(make_pair(a, make_pair(b, middle)));
+
+	while (!stack.empty()) {
+
+		int from = stack.back().first;
+		int to = stack.back().second.first;
+		int mid = stack.back().second.second;
+		stack.pop_back();
+
+		// Original edge
+		if (mid < 0) {
+			path.push_back(to);
+			continue;
+		}
+
+		// mid->to is an upward edge of mid
+		int second = -1;
+		for (int i = up_first[mid]; i < up_first[mid + 1]; i++)
+			if (up_edges[i].to == to)
+				second = up_edges[i].middle;
+
+		// from->mid is a downward edge of mid
+		int first = -1;
+		for (int i = down_first[mid]; i < down_first[mid + 1]; i++)
+			if (down_edges[i].to == from)
+				first = down_edges[i].middle;
+
+		// Unpack from->mid before mid->to
+		stack.push_back(make_pair(mid, make_pair(to, second)));
+		stack.push_back(make_pair(from, make_pair(mid, first)));
+	}
+
+}	// end - unpack_edge()
+
+// Full upward search from a vertex
+template <class T>
+void ContractionHierarchy<T>::upward_search(int from, bool forward,
+											vector< pair<int, T> >& space) {
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	reset_query();
+
+	// Search state of this direction
+	vector<T>& dist = forward ? fwd_dist : bwd_dist;
+	vector<int>& first = forward ? up_first : down_first;
+	vector<CHEdge>& edges = forward ? up_edges : down_edges;
+
+	// Min-queue of (distance, vertex)
+	priority_queue< pair<T, int>,
+					vector< pair<T, int> >,
+					greater< pair<T, int> > > queue;
+
+	dist[from] = 0;
+	touched.push_back(from);
+	queue.push(make_pair((T) 0, from));
+
+	while (!queue.empty()) {
+
+		T d = queue.top().first;
+		int u = queue.top().second;
+		queue.pop();
+
+		// Skip stale entries
+		if (d > dist[u])
+			continue;
+
+		space.push_back(make_pair(u, d));
+
+		// Relax the upward edges
+		for (int i = first[u]; i < first[u + 1]; i++) {
+
+			int v = edges[i].to;
+			T next = d + edges[i].weight;
+
+			if (next < dist[v]) {
+				if (dist[v] == infinity)
+					touched.push_back(v);
+				dist[v] = next;
+				queue.push(make_pair(next, v));
+			}
+		}
+	}
+
+}	// end - upward_search()
+
+// Many-to-many sources x targets distance table
+template <class T>
+DistanceTable<T> ContractionHierarchy<T>::distance_table(
+											const vector<int>& sources,
+											const vector<int>& targets) {
+
+	// The output table
+	int rows = sources.size();
+	int cols = targets.size();
+	DistanceTable<T> table(rows, cols);
+
+	// Check for valid vertices
+	for (auto v : sources)
+		if (v < 0 || v >= vertices)
+			return table;
+	for (auto v : targets)
+		if (v < 0 || v >= vertices)
+			return table;
+
+	// Bucket of (target column, distance) entries at each vertex
+	vector<int> bucket_first(vertices + 1, 0);
+	vector< pair<int, T> > bucket;
+
+	// Backward search spaces of the targets
+	vector< vector< pair<int, T> > > spaces(cols);
+	for (int j = 0; j < cols; j++) {
+		upward_search(targets[j], false, spaces[j]);
+		for (auto &entry : spaces[j])
+			bucket_first[entry.first + 1]++;
+	}
+
+	// Prefix sums give the first entry of each bucket
+	for (int v = 0; v < vertices; v++)
+		bucket_first[v + 1] += bucket_first[v];
+
+	// Fill the buckets - contiguous per vertex
+	bucket.resize(bucket_first[vertices]);
+	vector<int> fill_at(bucket_first.begin(), bucket_first.end() - 1);
+	for (int j = 0; j < cols; j++) {
+		for (auto &entry : spaces[j])
+			bucket[fill_at[entry.first]++] = make_pair(j, entry.second);
+		vector< pair<int, T> >().swap(spaces[j]);
+	}
+
+	// Forward search of each source scans the buckets it settles
+	vector< pair<int, T> > space;
+	for (int i = 0; i < rows; i++) {
+
+		space.clear();
+		upward_search(sources[i], true, space);
+
+		T* row = table.row(i);
+		for (auto &entry : space) {
+			for (int b = bucket_first[entry.first];
+					 b < bucket_first[entry.first + 1]; b++) {
+				T d = entry.second + bucket[b].second;
+				if (d < row[bucket[b].first])
+					row[bucket[b].first] = d;
+			}
+		}
+	}
+
+	reset_query();
+
+	return table;
+
+}	// end - distance_table()
+
+// Write the hierarchy to a binary file
+template <class T>
+bool ContractionHierarchy<T>::save(string file_name) {
+
+	// Setup a file stream
+	ofstream data_file(file_name, ios::binary);
+	if (!data_file) {
+		cerr << "Couldn't open file: " << file_name << endl;
+		return false;
+	}
+
+	// Header - the weight size keeps <long> files out of <int> hierarchies
+	const char magic[4] = {'C', 'H', '0', '2'};
+	int weight_size = sizeof(T);
+	int up_size = up_edges.size();
+	int down_size = down_edges.size();
+	data_file.write(magic, sizeof(magic));
+	data_file.write((const char*) &weight_size, sizeof(weight_size));
+	data_file.write((const char*) &vertices, sizeof(vertices));
+	data_file.write((const char*) &shortcuts, sizeof(shortcuts));
+	data_file.write((const char*) &up_size, sizeof(up_size));
+	data_file.write((const char*) &down_size, sizeof(down_size));
+
+	// Rank and search graph arrays
+	data_file.write((const char*) rank.data(), vertices * sizeof(int));
+	data_file.write((const char*) up_first.data(), (vertices + 1) * sizeof(int));
+	data_file.write((const char*) down_first.data(), (vertices + 1) * sizeof(int));
+	data_file.write((const char*) up_edges.data(), up_size * sizeof(CHEdge));
+	data_file.write((const char*) down_edges.data(), down_size * sizeof(CHEdge));
+
+	if (!data_file) {
+		cerr << "Couldn't write file: " << file_name << endl;
+		return false;
+	}
+
+	return true;
+
+}	// end - save()
+
+// Read the hierarchy from a binary file
+template <class T>
+bool ContractionHierarchy<T>::load(string file_name) {
+
+	// Setup a file stream
+	ifstream data_file(file_name, ios::binary);
+	if (!data_file) {
+		cerr << "Couldn't open file: " << file_name << endl;
+		return false;
+	}
+
+	// Header
+	char magic[4];
+	int weight_size = 0;
+	int size = 0;
+	int count = 0;
+	int up_size = 0;
+	int down_size = 0;
+	data_file.read(magic, sizeof(magic));
+	data_file.read((char*) &weight_size, sizeof(weight_size));
+	data_file.read((char*) &size, sizeof(size));
+	data_file.read((char*) &count, sizeof(count));
+	data_file.read((char*) &up_size, sizeof(up_size));
+	data_file.read((char*) &down_size, sizeof(down_size));
+
+	// Check the header
+	if (!data_file || magic[0] != 'C' || magic[1] != 'H' ||
+		magic[2] != '0' || magic[3] != '2' ||
+		size < 0 || up_size < 0 || down_size < 0) {
+		cerr << "Invalid hierarchy file: " << file_name << endl;
+		return false;
+	}
+
+	// Check the weight type
+	if (weight_size != (int) sizeof(T)) {
+		cerr << "Hierarchy weight size " << weight_size << " != "
+			 << sizeof(T) << ": " << file_name << endl;
+		return false;
+	}
+
+	// Rank and search graph arrays - kept aside until they check out
+	vector<int> new_rank(size);
+	vector<int> new_up_first(size + 1);
+	vector<int> new_down_first(size + 1);
+	vector<CHEdge> new_up_edges(up_size);
+	vector<CHEdge> new_down_edges(down_size);
+	data_file.read((char*) new_rank.data(), size * sizeof(int));
+	data_file.read((char*) new_up_first.data(), (size + 1) * sizeof(int));
+	data_file.read((char*) new_down_first.data(), (size + 1) * sizeof(int));
+	data_file.read((char*) new_up_edges.data(), up_size * sizeof(CHEdge));
+	data_file.read((char*) new_down_edges.data(), down_size * sizeof(CHEdge));
+
+	if (!data_file) {
+		cerr << "Truncated hierarchy file: " << file_name << endl;
+		return false;
+	}
+
+	// Offsets must run from 0 to the edge count without going down
+	auto valid_first = [&](const vector<int>& first, int edges) {
+		if (first[0] != 0 || first[size] != edges)
+			return false;
+		for (int v = 0; v < size; v++)
+			if (first[v] > first[v + 1])
+				return false;
+		return true;
+	};
+
+	// Targets and shortcut middles must be vertices
+	auto valid_edges = [&](const vector<CHEdge>& edges) {
+		for (auto &e : edges)
+			if (e.to < 0 || e.to >= size || e.middle < -1 || e.middle >= size)
+				return false;
+		return true;
+	};
+
+	// Check the arrays
+	bool valid = valid_first(new_up_first, up_size) &&
+				 valid_first(new_down_first, down_size) &&
+				 valid_edges(new_up_edges) &&
+				 valid_edges(new_down_edges);
+	for (int v = 0; v < size && valid; v++)
+		valid = new_rank[v] >= 0 && new_rank[v] < size;
+
+	if (!valid) {
+		cerr << "Corrupt hierarchy file: " << file_name << endl;
+		return false;
+	}
+
+	rank.swap(new_rank);
+	up_first.swap(new_up_first);
+	down_first.swap(new_down_first);
+	up_edges.swap(new_up_edges);
+	down_edges.swap(new_down_edges);
+
+	// Initialize the members
+	vertices = size;
+	shortcuts = count;
+
+	// Allocate the query state
+	fwd_dist.assign(vertices, numeric_limits<T>::max());
+	bwd_dist.assign(vertices, numeric_limits<T>::max());
+	fwd_parent.assign(vertices, -1);
+	bwd_parent.assign(vertices, -1);
+	fwd_middle.assign(vertices, -1);
+	bwd_middle.assign(vertices, -1);
+	touched.clear();
+	meeting_node = -1;
+
+	return true;
+
+}	// end - load()
+
+// Print the hierarchy statistics
+template <class T>
+void ContractionHierarchy<T>::print_stats() {
+
+	cout << endl;
+
+	// Print the number of vertices
+	cout << "vertices = " << vertices << endl;
+
+	// Print the number of shortcuts
+	cout << "shortcuts = " << shortcuts << endl;
+
+	// Print the search graph sizes
+	cout << "upward edges = " << up_edges.size() << endl;
+	cout << "downward edges = " << down_edges.size() << endl;
+
+	cout << endl;
+
+}	// end - print_stats()
+
+#endif /* CONTRACTIONHIERARCHY_H_ */
@@ -0,0 +1,141 @@
+/*
+ * ContractionHierarchy_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef CONTRACTIONHIERARCHY_CLASS_H_
+#define CONTRACTIONHIERARCHY_CLASS_H_
+
+#include <vector>
+#include <queue>
+#include <functional>
+
+using namespace std;
+
+#include "Graph.h"
+#include "DistanceTable.h"
+
+
+// Contraction Hierarchies point-to-point shortest-path engine
+template <class T>
+class ContractionHierarchy {
+
+private:
+
+	// Hierarchy edge
+	// middle is the contracted vertex of a shortcut, -1 for an original edge
+	struct CHEdge {
+		int to;
+		T weight;
+		int middle;
+	};
+
+	// Number of vertices
+	int vertices;
+
+	// Number of shortcuts added by the contraction
+	int shortcuts;
+
+	// Contraction order of each vertex
+	vector<int> rank;
+
+	// Upward edges v->w, rank[w] > rank[v]
+	vector<int> up_first;
+	vector<CHEdge> up_edges;
+
+	// Downward edges u->v stored at v (to = u), rank[u] > rank[v]
+	vector<int> down_first;
+	vector<CHEdge> down_edges;
+
+	// Query search state
+	vector<T> fwd_dist;
+	vector<T> bwd_dist;
+	vector<int> fwd_parent;
+	vector<int> bwd_parent;
+	vector<int> fwd_middle;
+	vector<int> bwd_middle;
+	vector<int> touched;
+
+	// Vertex where the last query's searches met
+	int meeting_node;
+
+	// Witness search limits
+	int witness_settle_limit;
+
+	// Witness search state
+	vector<T> witness_dist;
+	vector<int> witness_touched;
+
+	// Preprocessing - contract every vertex of the graph
+	void contract(vector< vector<CHEdge> >&, vector< vector<CHEdge> >&);
+
+	// Count (or add) the shortcuts needed to contract a vertex
+	int contract_node(vector< vector<CHEdge> >&,
+					  vector< vector<CHEdge> >&,
+					  vector<bool>&, int, bool);
+
+	// Bounded Dijkstra from a vertex avoiding the contracted one
+	void witness_search(vector< vector<CHEdge> >&,
+						vector<bool>&, int, int, T);
+
+	// Add or lower the u->x shortcut
+	void add_shortcut(vector< vector<CHEdge> >&,
+					  vector< vector<CHEdge> >&, int, int, T, int);
+
+	// Build the upward and downward search graphs
+	void build_search_graph(vector< vector<CHEdge> >&,
+							vector< vector<CHEdge> >&);
+
+	// Append the original vertices of an edge to a path
+	void unpack_edge(int, int, int, list<int>&);
+
+	// Reset the query search state
+	void reset_query();
+
+	// Full upward search - appends (vertex, distance) of the search space
+	void upward_search(int, bool, vector< pair<int, T> >&);
+
+public:
+
+	// Empty hierarchy - use load()
+	ContractionHierarchy();
+
+	// Preprocess the specified graph
+	ContractionHierarchy(Graph<T>&);
+
+	// Return the number of vertices
+	int Vertices();
+
+	// Return the number of shortcuts
+	int Shortcuts();
+
+	// Return the contraction rank of a vertex
+	int get_rank(int);
+
+	// Shortest-path distance between two vertices
+	// Returns numeric_limits<T>::max() if unreachable
+	T query(int, int);
+
+	// Shortest path of original vertices between two vertices
+	list<int> query_path(int, int);
+
+	// Many-to-many sources x targets distance table
+	// Bucket-based - one upward search per source and per target
+	DistanceTable<T> distance_table(const vector<int>&, const vector<int>&);
+
+	// Write the hierarchy to a binary file
+	bool save(string);
+
+	// Read the hierarchy from a binary file
+	// Rejects another weight type or out-of-range arrays, keeps the
+	// current hierarchy on failure
+	bool load(string);
+
+	// Print the hierarchy statistics
+	void print_stats();
+
+};	// end - ContractionHierarchy class
+
+#endif /* CONTRACTIONHIERARCHY_CLASS_H_ */
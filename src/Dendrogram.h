@@ -0,0 +1,131 @@
+/*
+ * Dendrogram.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef DENDROGRAM_H_
+#define DENDROGRAM_H_
+
+#include "Dendrogram_class.h"
+
+
+// Constructors
+
+// Empty dendrogram
+template <class T>
+Dendrogram<T>::Dendrogram():vertices(0) {
+}
+
+// Run Kruskal once and record the merges
+template <class T>
+Dendrogram<T>::Dendrogram(Graph<T>& graph):vertices(graph.Vertices()) {
+
+	// The sorted edge list
+	EdgeList<T> edges(graph);
+	edges.sort();
+
+	// One set per vertex and the dendrogram node of each root
+	DisjointSet sets(vertices);
+	vector<int> node(vertices);
+	for (int i = 0; i < vertices; i++)
+		node[i] = i;
+
+	merges.reserve(max(vertices - 1, 0));
+
+	// Iterate through the edges
+	for (auto &edge : edges) {
+
+		int ru = sets.find(edge.u);
+		int rv = sets.find(edge.v);
+
+		// If they are in the same tree - skip
+		if (ru == rv)
+			continue;
+
+		merges.push_back(Merge{edge.weight, edge.u, edge.v, node[ru], node[rv]});
+
+		// The merged root stands for the new node
+		sets.merge(ru, rv);
+		node[sets.find(ru)] = vertices + merges.size() - 1;
+
+		// If nothing remaining - exit loop
+		if ((int) merges.size() == vertices - 1)
+			break;
+	}
+
+}	// end - Dendrogram(Graph)
+
+// Methods
+
+// Number of merges applied for k clusters
+template <class T>
+int Dendrogram<T>::cut(int k) {
+
+	int applied = vertices - max(k, 1);
+	return max(0, min(applied, (int) merges.size()));
+
+}	// end - cut()
+
+// Number of clusters after the k-cluster cut
+template <class T>
+int Dendrogram<T>::clusters(int k) {
+	return vertices - cut(k);
+}
+
+// Smallest distance between two of k clusters
+template <class T>
+T Dendrogram<T>::max_spacing(int k) {
+
+	// The next merge joins the two closest clusters
+	int next = cut(k);
+	if (next >= (int) merges.size())
+		return numeric_limits<T>::max();
+
+	return merges[next].weight;
+
+}	// end - max_spacing()
+
+// Cluster label of every vertex
+template <class T>
+vector<int> Dendrogram<T>::cluster_labels(int k) {
+
+	int applied = cut(k);
+
+	// Label of each dendrogram node, -1 if not yet known
+	vector<int> label(vertices + applied, -1);
+	int next = 0;
+
+	// Parents are created after their children - walk the applied merges
+	// down from the top, each unlabeled node starts a cluster
+	for (int i = applied - 1; i >= 0; i--) {
+
+		int node = vertices + i;
+		if (label[node] < 0)
+			label[node] = next++;
+
+		label[merges[i].left] = label[node];
+		label[merges[i].right] = label[node];
+	}
+
+	// Unmerged vertices are singleton clusters
+	for (int v = 0; v < vertices; v++)
+		if (label[v] < 0)
+			label[v] = next++;
+
+	// Renumber in order of each cluster's smallest vertex
+	vector<int> order(next, -1);
+	int count = 0;
+	vector<int> result(vertices);
+	for (int v = 0; v < vertices; v++) {
+		if (order[label[v]] < 0)
+			order[label[v]] = count++;
+		result[v] = order[label[v]];
+	}
+
+	return result;
+
+}	// end - cluster_labels()
+
+#endif /* DENDROGRAM_H_ */
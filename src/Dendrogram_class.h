@@ -0,0 +1,79 @@
+/*
+ * Dendrogram_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef DENDROGRAM_CLASS_H_
+#define DENDROGRAM_CLASS_H_
+
+#include <vector>
+
+using namespace std;
+
+#include "Graph.h"
+#include "EdgeList.h"
+#include "DisjointSet.h"
+
+
+// Single-linkage dendrogram - the Kruskal merge order of a graph
+// Leaves are vertices 0..V-1, merge i creates node V + i
+template <class T>
+class Dendrogram {
+
+public:
+
+	// One merge - the MST edge and the two merged nodes
+	struct Merge {
+		T weight;
+		int u;
+		int v;
+		int left;
+		int right;
+	};
+
+private:
+
+	// Number of vertices
+	int vertices;
+
+	// Merges in ascending weight order
+	vector<Merge> merges;
+
+	// Number of merges applied for k clusters
+	int cut(int);
+
+public:
+
+	// Empty dendrogram
+	Dendrogram();
+
+	// Run Kruskal once and record the merges
+	Dendrogram(Graph<T>&);
+
+	// Return the number of vertices
+	int Vertices() const {
+		return vertices;
+	}
+
+	// Return the merges
+	const vector<Merge>& Merges() const {
+		return merges;
+	}
+
+	// Number of clusters after the k-cluster cut - more than k if the
+	// graph has more than k components
+	int clusters(int);
+
+	// Smallest distance between two of k clusters, O(1)
+	// numeric_limits<T>::max() if nothing is left to merge
+	T max_spacing(int);
+
+	// Cluster label 0..clusters(k)-1 of every vertex, O(V)
+	// Labels are numbered in order of each cluster's smallest vertex
+	vector<int> cluster_labels(int);
+
+};	// end - Dendrogram class
+
+#endif /* DENDROGRAM_CLASS_H_ */
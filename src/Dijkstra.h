@@ -0,0 +1,302 @@
+/*
+ * Dijkstra.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef DIJKSTRA_H_
+#define DIJKSTRA_H_
+
+#include "Dijkstra_class.h"
+
+
+// Constructors
+
+// Search the specified graph
+template <class T>
+Dijkstra<T>::Dijkstra(const AdjacencyList<T>& graph):graph(graph),
+													  potentials(nullptr),
+													  ws(Workspace<T>::local()),
+													  min_potential(0),
+													  last_source(-1) {
+}	// end - Dijkstra(AdjacencyList)
+
+// Search the reweighted graph
+template <class T>
+Dijkstra<T>::Dijkstra(const AdjacencyList<T>& graph,
+					  const T* potentials):graph(graph),
+										   potentials(potentials),
+										   ws(Workspace<T>::local()),
+										   min_potential(0),
+										   last_source(-1) {
+
+	// Real distance >= reweighted distance - h(source) + min_potential
+	if (potentials != nullptr)
+		for (int v = 0; v < graph.Vertices(); v++)
+			min_potential = min(min_potential, potentials[v]);
+
+}	// end - Dijkstra(AdjacencyList, potentials)
+
+// Search the reweighted graph, smallest potential precomputed
+template <class T>
+Dijkstra<T>::Dijkstra(const AdjacencyList<T>& graph,
+					  const T* potentials,
+					  T min_potential):graph(graph),
+									   potentials(potentials),
+									   ws(Workspace<T>::local()),
+									   min_potential(min_potential),
+									   last_source(-1) {
+}	// end - Dijkstra(AdjacencyList, potentials, min_potential)
+
+// Methods
+
+// Settle every vertex reachable from source
+// Leaves the reweighted distances and predecessors in the workspace
+template <class T>
+void Dijkstra<T>::search(int source) {
+
+	run_until(source, [](int, T) { return true; });
+
+}	// end - search()
+
+// Search from source until visit(vertex, key) returns false
+template <class T>
+template <class Visit>
+void Dijkstra<T>::run_until(int source, Visit visit) {
+
+	// Start a new query - O(previous query) reset
+	ws.reset(graph.Vertices());
+	last_source = source;
+
+	// Seed the search
+	ws.label(source, 0, -1);
+	ws.push(0, source);
+
+	while (!ws.empty()) {
+
+		// Closest unsettled vertex
+		pair<T, int> top = ws.pop();
+		T d = top.first;
+		int u = top.second;
+
+		// Skip stale entries
+		if (ws.is_settled(u))
+			continue;
+		ws.settle(u);
+
+		// Stop when the caller has seen enough
+		if (!visit(u, d))
+			return;
+
+		// Potential of the tail
+		T hu = (potentials != nullptr) ? potentials[u] : 0;
+
+		// Relax the outgoing edges
+		for (int e = graph.out_begin(u); e < graph.out_end(u); e++) {
+
+			int v = graph.head(e);
+			if (ws.is_settled(v))
+				continue;
+
+			// Reweighted edge - non-negative for valid potentials
+			T w = graph.weight(e);
+			if (potentials != nullptr)
+				w += hu - potentials[v];
+
+			T next = d + w;
+			if (next < ws.distance(v)) {
+				ws.label(v, next, u);
+				ws.push(next, v);
+			}
+		}
+	}
+
+}	// end - run_until()
+
+// Real distance of a searched vertex
+template <class T>
+T Dijkstra<T>::unweight(int source, int v) {
+
+	T d = ws.distance(v);
+
+	// Undo the reweighting
+	if (potentials != nullptr && d != numeric_limits<T>::max())
+		d += potentials[v] - potentials[source];
+
+	return d;
+
+}	// end - unweight()
+
+// One-to-all distances from source
+template <class T>
+void Dijkstra<T>::run(int source, T* row) {
+
+	search(source);
+
+	// Unreached vertices read as infinity
+	for (int v = 0; v < graph.Vertices(); v++)
+		row[v] = unweight(source, v);
+
+}	// end - run(row)
+
+// One-to-all distances and predecessor tree from source
+template <class T>
+void Dijkstra<T>::run(int source, SSSPTree<T>& tree) {
+
+	search(source);
+
+	tree.assign(source, graph.Vertices());
+
+	// Copy out the reached vertices
+	T* dist = tree.distances();
+	int* pred = tree.predecessors();
+	for (auto v : ws.Touched()) {
+		dist[v] = unweight(source, v);
+		pred[v] = ws.predecessor(v);
+	}
+
+}	// end - run(tree)
+
+// One-to-all search from source
+template <class T>
+void Dijkstra<T>::run(int from) {
+
+	search(from);
+
+}	// end - run()
+
+// Distance to a vertex from the last run(source)
+template <class T>
+T Dijkstra<T>::distance(int v) {
+
+	// Check for a search
+	if (last_source < 0)
+		return numeric_limits<T>::max();
+
+	return unweight(last_source, v);
+
+}	// end - distance()
+
+// Fill the last source's row of a next-hop matrix from the predecessors
+template <class T>
+void Dijkstra<T>::next_hops(HopMatrix& hops) {
+
+	// Check for a search
+	if (last_source < 0)
+		return;
+
+	int source = last_source;
+
+	// The row starts as "no path"
+	for (int v = 0; v < graph.Vertices(); v++)
+		hops.set(source, v, -1);
+	hops.set(source, source, source);
+
+	// The hop of a vertex is the hop of its predecessor
+	// Walk up to a known hop and fill in the chain - O(V) per row
+	for (auto v : ws.Touched()) {
+
+		chain.clear();
+		int u = v;
+		while (hops.next(source, u) < 0 && ws.predecessor(u) != source) {
+			chain.push_back(u);
+			u = ws.predecessor(u);
+		}
+
+		// Children of the source are their own hop
+		int hop = hops.next(source, u);
+		if (hop < 0) {
+			hop = u;
+			hops.set(source, u, hop);
+		}
+
+		for (auto w : chain)
+			hops.set(source, w, hop);
+	}
+
+}	// end - next_hops()
+
+// Every vertex within distance R of source
+template <class T>
+vector< pair<int, T> > Dijkstra<T>::within_radius(int source, T radius) {
+
+	vector< pair<int, T> > result;
+
+	// Check for a valid source
+	if (source < 0 || source >= graph.Vertices())
+		return result;
+
+	T hs = (potentials != nullptr) ? potentials[source] : 0;
+
+	run_until(source, [&](int v, T key) {
+
+		// Nothing closer than the radius is left
+		if (key - hs + min_potential > radius)
+			return false;
+
+		T d = unweight(source, v);
+		if (d <= radius)
+			result.push_back(make_pair(v, d));
+
+		return true;
+	});
+
+	// Reweighted settle order isn't distance order
+	if (potentials != nullptr)
+		sort(result.begin(), result.end(),
+			 [](const pair<int, T>& a, const pair<int, T>& b) {
+				return a.second < b.second;
+			 });
+
+	return result;
+
+}	// end - within_radius()
+
+// The k nearest vertices with predicate(vertex)
+template <class T>
+template <class Predicate>
+vector< pair<int, T> > Dijkstra<T>::k_nearest(int source, int k,
+											  Predicate predicate) {
+
+	vector< pair<int, T> > result;
+
+	// Check for a valid source
+	if (k < 1 || source < 0 || source >= graph.Vertices())
+		return result;
+
+	T hs = (potentials != nullptr) ? potentials[source] : 0;
+
+	// Max-heap on distance of the best k matches so far
+	auto farther = [](const pair<int, T>& a, const pair<int, T>& b) {
+		return a.second < b.second;
+	};
+
+	run_until(source, [&](int v, T key) {
+
+		// k matches and nothing closer is left
+		if ((int) result.size() == k &&
+			key - hs + min_potential >= result.front().second)
+			return false;
+
+		if (!predicate(v))
+			return true;
+
+		// Keep the k closest
+		result.push_back(make_pair(v, unweight(source, v)));
+		push_heap(result.begin(), result.end(), farther);
+		if ((int) result.size() > k) {
+			pop_heap(result.begin(), result.end(), farther);
+			result.pop_back();
+		}
+
+		return true;
+	});
+
+	sort_heap(result.begin(), result.end(), farther);
+
+	return result;
+
+}	// end - k_nearest()
+
+#endif /* DIJKSTRA_H_ */
@@ -0,0 +1,98 @@
+/*
+ * Dijkstra_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef DIJKSTRA_CLASS_H_
+#define DIJKSTRA_CLASS_H_
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+using namespace std;
+
+#include "AdjacencyList.h"
+#include "SSSPTree.h"
+#include "Workspace.h"
+#include "HopMatrix.h"
+
+
+// Binary-heap Dijkstra over an adjacency list
+// Searches run in the constructing thread's Workspace - no per-query allocation
+template <class T>
+class Dijkstra {
+
+private:
+
+	// The graph
+	const AdjacencyList<T>& graph;
+
+	// Johnson potentials, nullptr for non-negative graphs
+	const T* potentials;
+
+	// Search state - the calling thread's workspace
+	Workspace<T>& ws;
+
+	// Smallest potential, 0 without potentials
+	T min_potential;
+
+	// Source of the last search
+	int last_source;
+
+	// Predecessor chain scratch for next_hops()
+	vector<int> chain;
+
+	// Settle every vertex reachable from a source
+	void search(int);
+
+	// Real distance of a searched vertex
+	T unweight(int, int);
+
+public:
+
+	// Search the specified graph
+	Dijkstra(const AdjacencyList<T>&);
+
+	// Search the graph reweighted by w(u,v) + h(u) - h(v)
+	Dijkstra(const AdjacencyList<T>&, const T*);
+
+	// Same, with the smallest potential already known - no O(V) scan
+	Dijkstra(const AdjacencyList<T>&, const T*, T);
+
+	// One-to-all distances from source into row[0..V)
+	// Unreachable vertices are numeric_limits<T>::max()
+	void run(int, T*);
+
+	// One-to-all distances and predecessor tree from source
+	void run(int, SSSPTree<T>&);
+
+	// One-to-all search from source, read back with distance()
+	void run(int);
+
+	// Search from source until visit(vertex, key) returns false
+	// Vertices are visited in settle order, key is the reweighted distance
+	// Read real distances back with distance()
+	template <class Visit>
+	void run_until(int, Visit);
+
+	// Distance to a vertex from the last run(source)
+	T distance(int);
+
+	// Fill the last source's row of a next-hop matrix
+	void next_hops(HopMatrix&);
+
+	// (vertex, distance) of every vertex within distance R of source
+	// Ascending distance, only the explored region is touched
+	vector< pair<int, T> > within_radius(int, T);
+
+	// (vertex, distance) of the k nearest vertices with predicate(vertex)
+	// Ascending distance, stops as soon as no closer match can be settled
+	template <class Predicate>
+	vector< pair<int, T> > k_nearest(int, int, Predicate);
+
+};	// end - Dijkstra class
+
+#endif /* DIJKSTRA_CLASS_H_ */
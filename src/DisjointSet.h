@@ -0,0 +1,186 @@
+/*
+ * DisjointSet.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef DISJOINTSET_H_
+#define DISJOINTSET_H_
+
+#include "DisjointSet_class.h"
+
+
+// DisjointSet
+
+// Empty forest
+inline DisjointSet::DisjointSet():sets(0) {
+}
+
+// n singleton sets
+inline DisjointSet::DisjointSet(int n):sets(0) {
+	assign(n);
+}
+
+// Reset to n singleton sets
+inline void DisjointSet::assign(int n) {
+
+	parent.resize(n);
+	set_size.assign(n, 1);
+	for (int i = 0; i < n; i++)
+		parent[i] = i;
+
+	sets = n;
+
+}	// end - assign()
+
+// Return the number of elements
+inline int DisjointSet::Elements() const {
+	return parent.size();
+}
+
+// Return the number of sets
+inline int DisjointSet::Sets() const {
+	return sets;
+}
+
+// Return the root of an element's set
+inline int DisjointSet::find(int x) {
+
+	// Point every other element at its grandparent on the way up
+	uint32_t i = x;
+	while (parent[i] != i) {
+		parent[i] = parent[parent[i]];
+		i = parent[i];
+	}
+
+	return i;
+
+}	// end - find()
+
+// Merge two sets, false if already the same set
+inline bool DisjointSet::merge(int x, int y) {
+
+	uint32_t rx = find(x);
+	uint32_t ry = find(y);
+
+	// If they are in the same set - nothing to do
+	if (rx == ry)
+		return false;
+
+	// Smaller set goes under the larger
+	if (set_size[rx] < set_size[ry])
+		swap(rx, ry);
+	parent[ry] = rx;
+	set_size[rx] += set_size[ry];
+
+	sets--;
+	return true;
+
+}	// end - merge()
+
+// Return true if both elements are in the same set
+inline bool DisjointSet::same(int x, int y) {
+	return find(x) == find(y);
+}
+
+// Return the element count of an element's set
+inline int DisjointSet::size(int x) {
+	return set_size[find(x)];
+}
+
+
+// ConcurrentDisjointSet
+
+// Empty forest
+inline ConcurrentDisjointSet::ConcurrentDisjointSet() {
+}
+
+// n singleton sets
+inline ConcurrentDisjointSet::ConcurrentDisjointSet(int n) {
+	assign(n);
+}
+
+// Reset to n singleton sets
+inline void ConcurrentDisjointSet::assign(int n) {
+
+	// Atomics can't be copied - rebuild the vector
+	vector< atomic<uint32_t> > fresh(n);
+	parent.swap(fresh);
+	for (int i = 0; i < n; i++)
+		parent[i].store(i, memory_order_relaxed);
+
+}	// end - assign()
+
+// Return the number of elements
+inline int ConcurrentDisjointSet::Elements() const {
+	return parent.size();
+}
+
+// Return the root of an element's set
+inline int ConcurrentDisjointSet::find(int x) {
+
+	uint32_t i = x;
+	while (true) {
+
+		uint32_t p = parent[i].load();
+		if (p == i)
+			return i;
+
+		// Halve the path - losing the race only skips the shortcut
+		uint32_t g = parent[p].load();
+		if (g != p)
+			parent[i].compare_exchange_weak(p, g);
+
+		i = g;
+	}
+
+}	// end - find()
+
+// Merge two sets, false if already the same set
+inline bool ConcurrentDisjointSet::merge(int x, int y) {
+
+	while (true) {
+
+		uint32_t rx = find(x);
+		uint32_t ry = find(y);
+
+		// If they are in the same set - nothing to do
+		if (rx == ry)
+			return false;
+
+		// Link the larger root under the smaller
+		if (rx < ry)
+			swap(rx, ry);
+		uint32_t expected = rx;
+		if (parent[rx].compare_exchange_strong(expected, ry))
+			return true;
+
+		// rx stopped being a root - retry from the new roots
+	}
+
+}	// end - merge()
+
+// Return true if both elements are in the same set
+inline bool ConcurrentDisjointSet::same(int x, int y) {
+
+	while (true) {
+
+		uint32_t rx = find(x);
+		uint32_t ry = find(y);
+		if (rx == ry)
+			return true;
+
+		// rx is still a root, so they were apart at that moment
+		if (parent[rx].load() == rx)
+			return false;
+	}
+
+}	// end - same()
+
+// Point an element straight at its root
+inline void ConcurrentDisjointSet::flatten(int x) {
+	parent[x].store(find(x), memory_order_relaxed);
+}
+
+#endif /* DISJOINTSET_H_ */
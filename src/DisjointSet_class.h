@@ -0,0 +1,105 @@
+/*
+ * DisjointSet_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef DISJOINTSET_CLASS_H_
+#define DISJOINTSET_CLASS_H_
+
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+using namespace std;
+
+
+// Disjoint-set forest over elements 0..n-1
+// Union by size, iterative path halving
+class DisjointSet {
+
+private:
+
+	// Parent of each element - roots point to themselves
+	vector<uint32_t> parent;
+
+	// Element count of each root's set
+	vector<uint32_t> set_size;
+
+	// Number of sets
+	int sets;
+
+public:
+
+	// Empty forest
+	DisjointSet();
+
+	// n singleton sets
+	DisjointSet(int);
+
+	// Reset to n singleton sets
+	void assign(int);
+
+	// Return the number of elements
+	int Elements() const;
+
+	// Return the number of sets
+	int Sets() const;
+
+	// Return the root of an element's set
+	int find(int);
+
+	// Merge two sets, false if already the same set
+	bool merge(int, int);
+
+	// Return true if both elements are in the same set
+	bool same(int, int);
+
+	// Return the element count of an element's set
+	int size(int);
+
+};	// end - DisjointSet class
+
+
+// Lock-free disjoint-set forest for concurrent merges
+// Roots link under the smaller index by CAS, so parents only decrease
+// and find() can halve paths without locks
+class ConcurrentDisjointSet {
+
+private:
+
+	// Parent of each element - roots point to themselves
+	vector< atomic<uint32_t> > parent;
+
+public:
+
+	// Empty forest
+	ConcurrentDisjointSet();
+
+	// n singleton sets
+	ConcurrentDisjointSet(int);
+
+	// Reset to n singleton sets - not thread-safe
+	void assign(int);
+
+	// Return the number of elements
+	int Elements() const;
+
+	// Return the root of an element's set
+	int find(int);
+
+	// Merge two sets, false if already the same set
+	bool merge(int, int);
+
+	// Return true if both elements are in the same set
+	bool same(int, int);
+
+	// Point an element straight at its root
+	// Only while no merges are running
+	void flatten(int);
+
+};	// end - ConcurrentDisjointSet class
+
+#endif /* DISJOINTSET_CLASS_H_ */
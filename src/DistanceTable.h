@@ -0,0 +1,60 @@
+/*
+ * DistanceTable.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef DISTANCETABLE_H_
+#define DISTANCETABLE_H_
+
+#include "DistanceTable_class.h"
+
+
+// Empty table
+template <class T>
+DistanceTable<T>::DistanceTable():rows(0),
+								  cols(0),
+								  stride(0) {
+}
+
+// Table of sources x targets
+template <class T>
+DistanceTable<T>::DistanceTable(int sources, int targets):rows(sources),
+														  cols(targets),
+														  stride(0) {
+
+	// Pad the rows to whole 64-byte vectors
+	int lanes = max(1, (int) (64 / sizeof(T)));
+	stride = ((targets + lanes - 1) / lanes) * lanes;
+
+	data.assign((size_t) rows * stride, numeric_limits<T>::max());
+
+}	// end - DistanceTable(int, int)
+
+// Print the table
+template <class T>
+void DistanceTable<T>::print_table() {
+
+	const int cout_width = 7;
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	cout << "Distance Table:" << endl << endl;
+
+	for (int i = 0; i < rows; i++) {
+		for (int j = 0; j < cols; j++) {
+			cout.width(cout_width);
+			if (at(i, j) == infinity)
+				cout << " ";
+			else
+				cout << at(i, j);
+		}
+		cout << endl;
+	}
+	cout << endl;
+
+}	// end - print_table()
+
+#endif /* DISTANCETABLE_H_ */
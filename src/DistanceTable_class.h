@@ -0,0 +1,76 @@
+/*
+ * DistanceTable_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef DISTANCETABLE_CLASS_H_
+#define DISTANCETABLE_CLASS_H_
+
+#include <iostream>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+using namespace std;
+
+
+// Many-to-many distance table
+// Contiguous row-major, rows padded to a multiple of 64 bytes
+template <class T>
+class DistanceTable {
+
+private:
+
+	// Number of sources
+	int rows;
+
+	// Number of targets
+	int cols;
+
+	// Elements between the starts of consecutive rows
+	int stride;
+
+	// The distances, numeric_limits<T>::max() if unreachable
+	vector<T> data;
+
+public:
+
+	// Empty table
+	DistanceTable();
+
+	// Table of sources x targets initialized to infinity
+	DistanceTable(int, int);
+
+	// Return the number of sources
+	int Rows() {
+		return rows;
+	}
+
+	// Return the number of targets
+	int Cols() {
+		return cols;
+	}
+
+	// Return the row stride in elements
+	int Stride() {
+		return stride;
+	}
+
+	// Return the distance from source i to target j
+	T& at(int i, int j) {
+		return data[(size_t) i * stride + j];
+	}
+
+	// Return the start of row i
+	T* row(int i) {
+		return data.data() + (size_t) i * stride;
+	}
+
+	// Print the table
+	void print_table();
+
+};	// end - DistanceTable class
+
+#endif /* DISTANCETABLE_CLASS_H_ */
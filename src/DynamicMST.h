@@ -0,0 +1,577 @@
+/*
+ * DynamicMST.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef DYNAMICMST_H_
+#define DYNAMICMST_H_
+
+#include <iostream>
+#include <limits>
+
+#include "DynamicMST_class.h"
+
+
+// Constructors
+
+// Forest of isolated vertices
+template <class T>
+DynamicMST<T>::DynamicMST(int size):vertices(max(size, 0)),
+									mst_distance(0),
+									components(max(size, 0)),
+									stamp(0) {
+
+	nodes.assign(vertices, Node{{-1, -1}, -1, false, -1});
+	tree_adjacent.resize(vertices);
+	spare_adjacent.resize(vertices);
+	mark.assign(vertices, 0);
+
+}	// end - DynamicMST(size)
+
+// Minimum spanning forest of a graph
+template <class T>
+DynamicMST<T>::DynamicMST(Graph<T>& graph):vertices(graph.Vertices()),
+										   mst_distance(0),
+										   components(graph.Vertices()),
+										   stamp(0) {
+
+	nodes.assign(vertices, Node{{-1, -1}, -1, false, -1});
+	tree_adjacent.resize(vertices);
+	spare_adjacent.resize(vertices);
+	mark.assign(vertices, 0);
+
+	// The sorted edge list
+	EdgeList<T> list(graph);
+	list.sort();
+
+	// Kruskal - light edges that join two trees go into the forest
+	vector< Edge<T> > spares;
+	for (auto &edge : kruskal_tree(list.begin(), list.end(), vertices,
+								   nullptr, &spares))
+		add_tree(new_slot(edge.u, edge.v, edge.weight));
+
+	// The rest wait as spares - keep the first of an edge and its reverse
+	for (auto &edge : spares) {
+
+		if (edge.u == edge.v || slot_of.count(key(edge.u, edge.v)))
+			continue;
+
+		add_spare(new_slot(edge.u, edge.v, edge.weight));
+	}
+
+}	// end - DynamicMST(Graph)
+
+// Link-cut tree primitives
+
+// Return true if the node is the root of its splay tree
+template <class T>
+bool DynamicMST<T>::is_root(int x) {
+
+	int p = nodes[x].parent;
+	return p < 0 || (nodes[p].child[0] != x && nodes[p].child[1] != x);
+
+}	// end - is_root()
+
+// Push a pending reversal down to the children
+template <class T>
+void DynamicMST<T>::push(int x) {
+
+	if (!nodes[x].flip)
+		return;
+
+	swap(nodes[x].child[0], nodes[x].child[1]);
+	for (int c : nodes[x].child)
+		if (c >= 0)
+			nodes[c].flip = !nodes[c].flip;
+
+	nodes[x].flip = false;
+
+}	// end - push()
+
+// Recompute the heaviest edge node of a splay subtree
+template <class T>
+void DynamicMST<T>::pull(int x) {
+
+	// Vertex nodes carry no weight
+	int best = (x >= vertices) ? x : -1;
+
+	for (int c : nodes[x].child) {
+		if (c < 0 || nodes[c].best < 0)
+			continue;
+		if (best < 0 ||
+			edges[nodes[c].best - vertices].weight > edges[best - vertices].weight)
+			best = nodes[c].best;
+	}
+
+	nodes[x].best = best;
+
+}	// end - pull()
+
+// Rotate a node above its parent
+template <class T>
+void DynamicMST<T>::rotate(int x) {
+
+	int p = nodes[x].parent;
+	int g = nodes[p].parent;
+	int side = (nodes[p].child[1] == x);
+	int inner = nodes[x].child[!side];
+
+	// Grandparent - only a real child link if p isn't a splay root
+	if (!is_root(p))
+		nodes[g].child[nodes[g].child[1] == p] = x;
+	nodes[x].parent = g;
+
+	// The inner subtree moves across to p
+	nodes[p].child[side] = inner;
+	if (inner >= 0)
+		nodes[inner].parent = p;
+
+	nodes[x].child[!side] = p;
+	nodes[p].parent = x;
+
+	pull(p);
+	pull(x);
+
+}	// end - rotate()
+
+// Splay a node to the root of its splay tree
+template <class T>
+void DynamicMST<T>::splay(int x) {
+
+	// Push reversals from the splay root down to x
+	path.clear();
+	path.push_back(x);
+	for (int y = x; !is_root(y); y = nodes[y].parent)
+		path.push_back(nodes[y].parent);
+	for (int i = path.size() - 1; i >= 0; i--)
+		push(path[i]);
+
+	while (!is_root(x)) {
+
+		int p = nodes[x].parent;
+
+		// Zig-zig rotates the parent first, zig-zag the node twice
+		if (!is_root(p)) {
+			int g = nodes[p].parent;
+			bool zigzig = (nodes[g].child[1] == p) == (nodes[p].child[1] == x);
+			rotate(zigzig ? p : x);
+		}
+		rotate(x);
+	}
+
+}	// end - splay()
+
+// Make the root -> x path preferred, x ends at the splay root
+template <class T>
+void DynamicMST<T>::access(int x) {
+
+	int last = -1;
+	for (int y = x; y >= 0; y = nodes[y].parent) {
+		splay(y);
+		nodes[y].child[1] = last;
+		pull(y);
+		last = y;
+	}
+
+	splay(x);
+
+}	// end - access()
+
+// Reroot x's tree at x
+template <class T>
+void DynamicMST<T>::make_root(int x) {
+
+	access(x);
+	nodes[x].flip = !nodes[x].flip;
+
+}	// end - make_root()
+
+// Return the root of x's tree
+template <class T>
+int DynamicMST<T>::find_root(int x) {
+
+	access(x);
+
+	// Leftmost node of the path
+	while (true) {
+		push(x);
+		if (nodes[x].child[0] < 0)
+			break;
+		x = nodes[x].child[0];
+	}
+
+	// Splay it up to keep the amortized bound
+	splay(x);
+	return x;
+
+}	// end - find_root()
+
+// Join two trees with the edge x - y
+template <class T>
+void DynamicMST<T>::link(int x, int y) {
+
+	make_root(x);
+	nodes[x].parent = y;
+
+}	// end - link()
+
+// Remove the tree edge x - y
+template <class T>
+void DynamicMST<T>::cut(int x, int y) {
+
+	make_root(x);
+	access(y);
+
+	// x is now y's only left descendant
+	nodes[y].child[0] = -1;
+	nodes[x].parent = -1;
+	pull(y);
+
+}	// end - cut()
+
+// Heaviest edge slot on the u -> v tree path
+template <class T>
+int DynamicMST<T>::path_max(int u, int v) {
+
+	make_root(u);
+
+	// Not connected - u isn't v's root
+	if (find_root(v) != u)
+		return -1;
+
+	// The preferred path is now exactly u -> v
+	splay(v);
+
+	int best = nodes[v].best;
+	return best < 0 ? -1 : best - vertices;
+
+}	// end - path_max()
+
+// Edge bookkeeping
+
+// Edge key
+template <class T>
+uint64_t DynamicMST<T>::key(int u, int v) {
+
+	if (u > v)
+		swap(u, v);
+
+	return ((uint64_t) u << 32) | (uint32_t) v;
+
+}	// end - key()
+
+// New slot for an edge
+template <class T>
+int DynamicMST<T>::new_slot(int u, int v, T weight) {
+
+	int slot;
+
+	// Reuse a free slot
+	if (!free_slots.empty()) {
+		slot = free_slots.back();
+		free_slots.pop_back();
+		edges[slot] = Edge<T>{weight, u, v};
+		state[slot] = FREE;
+		tree_position[slot] = -1;
+	}
+	else {
+		slot = edges.size();
+		edges.push_back(Edge<T>{weight, u, v});
+		state.push_back(FREE);
+		tree_position.push_back(-1);
+		nodes.push_back(Node{{-1, -1}, -1, false, -1});
+	}
+
+	// A lone edge node
+	int x = vertices + slot;
+	nodes[x] = Node{{-1, -1}, -1, false, x};
+
+	slot_of[key(u, v)] = slot;
+	return slot;
+
+}	// end - new_slot()
+
+// Put a slot into the forest
+template <class T>
+void DynamicMST<T>::add_tree(int slot) {
+
+	int x = vertices + slot;
+	link(edges[slot].u, x);
+	link(x, edges[slot].v);
+
+	tree_adjacent[edges[slot].u].insert(slot);
+	tree_adjacent[edges[slot].v].insert(slot);
+
+	state[slot] = TREE;
+	tree_position[slot] = tree.size();
+	tree.push_back(slot);
+
+	// Accumulate the total cost
+	mst_distance += edges[slot].weight;
+	components--;
+
+}	// end - add_tree()
+
+// Take a slot out of the forest
+template <class T>
+void DynamicMST<T>::remove_tree(int slot) {
+
+	int x = vertices + slot;
+	cut(edges[slot].u, x);
+	cut(x, edges[slot].v);
+
+	tree_adjacent[edges[slot].u].erase(slot);
+	tree_adjacent[edges[slot].v].erase(slot);
+
+	// Swap-remove from the forest edge list
+	int position = tree_position[slot];
+	tree[position] = tree.back();
+	tree_position[tree[position]] = position;
+	tree.pop_back();
+
+	state[slot] = FREE;
+	tree_position[slot] = -1;
+
+	mst_distance -= edges[slot].weight;
+	components++;
+
+}	// end - remove_tree()
+
+// Put a slot into the spares
+template <class T>
+void DynamicMST<T>::add_spare(int slot) {
+
+	spare_adjacent[edges[slot].u].insert(slot);
+	spare_adjacent[edges[slot].v].insert(slot);
+	state[slot] = SPARE;
+
+}	// end - add_spare()
+
+// Take a slot out of the spares
+template <class T>
+void DynamicMST<T>::remove_spare(int slot) {
+
+	spare_adjacent[edges[slot].u].erase(slot);
+	spare_adjacent[edges[slot].v].erase(slot);
+	state[slot] = FREE;
+
+}	// end - remove_spare()
+
+// Add a slot that is in neither the forest nor the spares
+template <class T>
+void DynamicMST<T>::insert_slot(int slot) {
+
+	int u = edges[slot].u;
+	int v = edges[slot].v;
+
+	// Joins two trees - always in the forest
+	int heaviest = path_max(u, v);
+	if (heaviest < 0) {
+		add_tree(slot);
+		return;
+	}
+
+	// Replace the heaviest edge on the cycle if this one is lighter
+	if (edges[slot].weight < edges[heaviest].weight) {
+		remove_tree(heaviest);
+		add_spare(heaviest);
+		add_tree(slot);
+		return;
+	}
+
+	add_spare(slot);
+
+}	// end - insert_slot()
+
+// Reconnect the split trees of a and b with the lightest spare edge
+// O(smaller tree + its spare edges) - not the polylog bound of a
+// Holm et al. level structure
+template <class T>
+void DynamicMST<T>::reconnect(int a, int b) {
+
+	// New marks for the two searches
+	if (stamp > numeric_limits<int>::max() - 2) {
+		mark.assign(vertices, 0);
+		stamp = 0;
+	}
+	int id[2];
+	id[0] = ++stamp;
+	id[1] = ++stamp;
+
+	side[0].assign(1, a);
+	side[1].assign(1, b);
+	mark[a] = id[0];
+	mark[b] = id[1];
+
+	// Grow both trees a vertex at a time until the smaller one is done
+	size_t next[2] = {0, 0};
+	int small = -1;
+	while (small < 0)
+		for (int s = 0; s < 2; s++) {
+
+			if (next[s] == side[s].size()) {
+				small = s;
+				break;
+			}
+
+			int x = side[s][next[s]++];
+			for (int slot : tree_adjacent[x]) {
+				int y = (edges[slot].u == x) ? edges[slot].v : edges[slot].u;
+				if (mark[y] != id[s]) {
+					mark[y] = id[s];
+					side[s].push_back(y);
+				}
+			}
+		}
+
+	// Spares never join two trees unless they cross the new cut, so the
+	// lightest one leaving the smaller tree is the replacement
+	int best = -1;
+	for (int x : side[small])
+		for (int slot : spare_adjacent[x]) {
+
+			int y = (edges[slot].u == x) ? edges[slot].v : edges[slot].u;
+			if (mark[y] == id[small])
+				continue;
+
+			if (best < 0 || make_pair(edges[slot].weight, slot) <
+							make_pair(edges[best].weight, best))
+				best = slot;
+		}
+
+	if (best < 0)
+		return;
+
+	remove_spare(best);
+	add_tree(best);
+
+}	// end - reconnect()
+
+// Methods
+
+// Insert an edge or change its weight
+template <class T>
+void DynamicMST<T>::set_edge(int u, int v, T weight) {
+
+	// Check validity
+	if (u < 0 || u >= vertices || v < 0 || v >= vertices) {
+		cerr << "Invalid graph node: " << u << ":" << v << endl;
+		return;
+	}
+
+	// No self loops in a spanning tree
+	if (u == v)
+		return;
+
+	// Infinity removes the edge
+	if (weight == numeric_limits<T>::max()) {
+		remove_edge(u, v);
+		return;
+	}
+
+	auto found = slot_of.find(key(u, v));
+
+	// A new edge
+	if (found == slot_of.end()) {
+		insert_slot(new_slot(u, v, weight));
+		return;
+	}
+
+	int slot = found->second;
+	T old_weight = edges[slot].weight;
+
+	// Spare edge - reinsert with the new weight
+	if (state[slot] == SPARE) {
+		remove_spare(slot);
+		edges[slot].weight = weight;
+		insert_slot(slot);
+		return;
+	}
+
+	// Lighter forest edge - the forest stays minimal, fix the path maxima
+	if (!(weight > old_weight)) {
+		int x = vertices + slot;
+		access(x);
+		edges[slot].weight = weight;
+		pull(x);
+		mst_distance += weight - old_weight;
+		return;
+	}
+
+	// Heavier forest edge - it competes with the spares for its own cut
+	remove_tree(slot);
+	edges[slot].weight = weight;
+	add_spare(slot);
+	reconnect(u, v);
+
+}	// end - set_edge()
+
+// Remove an edge
+template <class T>
+void DynamicMST<T>::remove_edge(int u, int v) {
+
+	// Check validity
+	if (u < 0 || u >= vertices || v < 0 || v >= vertices) {
+		cerr << "Invalid graph node: " << u << ":" << v << endl;
+		return;
+	}
+
+	auto found = slot_of.find(key(u, v));
+	if (found == slot_of.end())
+		return;
+
+	int slot = found->second;
+	slot_of.erase(found);
+
+	// Spare edge - just forget it
+	if (state[slot] == SPARE)
+		remove_spare(slot);
+	// Forest edge - look for a replacement
+	else {
+		remove_tree(slot);
+		reconnect(u, v);
+	}
+
+	state[slot] = FREE;
+	free_slots.push_back(slot);
+
+}	// end - remove_edge()
+
+// Return true if the vertices are in the same tree
+template <class T>
+bool DynamicMST<T>::connected(int u, int v) {
+
+	// Check validity
+	if (u < 0 || u >= vertices || v < 0 || v >= vertices) {
+		cerr << "Invalid graph node: " << u << ":" << v << endl;
+		return false;
+	}
+
+	return find_root(u) == find_root(v);
+
+}	// end - connected()
+
+// Return the heaviest edge weight on the u -> v tree path
+template <class T>
+T DynamicMST<T>::bottleneck(int u, int v) {
+
+	// Check validity
+	if (u < 0 || u >= vertices || v < 0 || v >= vertices) {
+		cerr << "Invalid graph node: " << u << ":" << v << endl;
+		return numeric_limits<T>::max();
+	}
+
+	if (u == v)
+		return numeric_limits<T>::lowest();
+
+	int heaviest = path_max(u, v);
+	if (heaviest < 0)
+		return numeric_limits<T>::max();
+
+	return edges[heaviest].weight;
+
+}	// end - bottleneck()
+
+#endif /* DYNAMICMST_H_ */
@@ -0,0 +1,172 @@
+/*
+ * DynamicMST_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef DYNAMICMST_CLASS_H_
+#define DYNAMICMST_CLASS_H_
+
+#include <vector>
+#include <set>
+#include <unordered_map>
+#include <cstdint>
+
+using namespace std;
+
+#include "Graph.h"
+#include "EdgeList.h"
+#include "DisjointSet.h"
+
+
+// Minimum spanning forest kept up to date under edge changes
+// The forest is a link-cut tree with one node per vertex and one per edge,
+// so the heaviest edge on any tree path is found in amortized O(log V)
+template <class T>
+class DynamicMST {
+
+private:
+
+	// Link-cut tree node - a splay tree over each preferred path
+	struct Node {
+		int child[2];
+		int parent;
+		bool flip;
+
+		// Heaviest edge node in this splay subtree, -1 if none
+		int best;
+	};
+
+	// Number of vertices
+	int vertices;
+
+	// Vertex nodes, then one node per edge slot
+	vector<Node> nodes;
+
+	// Edge of each slot
+	vector< Edge<T> > edges;
+
+	// Slot state - free, in the forest or spare
+	enum slot_t {FREE, TREE, SPARE};
+	vector<slot_t> state;
+
+	// Free slots
+	vector<int> free_slots;
+
+	// Slot of each edge, keyed on (min(u, v), max(u, v))
+	unordered_map<uint64_t, int> slot_of;
+
+	// Forest and spare (non-forest) edge slots at each vertex
+	vector< set<int> > tree_adjacent;
+	vector< set<int> > spare_adjacent;
+
+	// Forest edge slots, and each slot's position in it
+	vector<int> tree;
+	vector<int> tree_position;
+
+	// Minimum spanning forest distance
+	T mst_distance;
+
+	// Number of trees in the forest
+	int components;
+
+	// Splay scratch path
+	vector<int> path;
+
+	// Reconnect scratch - the vertices of each split tree, and the mark
+	// of the last search that reached each vertex
+	vector<int> side[2];
+	vector<int> mark;
+	int stamp;
+
+	// Link-cut tree primitives
+	bool is_root(int);
+	void push(int);
+	void pull(int);
+	void rotate(int);
+	void splay(int);
+	void access(int);
+	void make_root(int);
+	int find_root(int);
+	void link(int, int);
+	void cut(int, int);
+
+	// Heaviest edge slot on the u -> v tree path, -1 if not connected
+	int path_max(int, int);
+
+	// Edge key
+	uint64_t key(int, int);
+
+	// New slot for an edge
+	int new_slot(int, int, T);
+
+	// Put a slot into / take it out of the forest
+	void add_tree(int);
+	void remove_tree(int);
+
+	// Put a slot into / take it out of the spares
+	void add_spare(int);
+	void remove_spare(int);
+
+	// Add a slot that is in neither the forest nor the spares
+	void insert_slot(int);
+
+	// Reconnect the split trees of two vertices with the lightest spare
+	// edge between them
+	void reconnect(int, int);
+
+public:
+
+	// Forest of isolated vertices
+	DynamicMST(int);
+
+	// Minimum spanning forest of a graph - Kruskal once
+	DynamicMST(Graph<T>&);
+
+	// Return the number of vertices
+	int Vertices() const {
+		return vertices;
+	}
+
+	// Return the minimum spanning forest distance
+	T Distance() const {
+		return mst_distance;
+	}
+
+	// Return the number of forest edges
+	int Edges() const {
+		return tree.size();
+	}
+
+	// Return the number of trees - 1 for a spanning tree
+	int Components() const {
+		return components;
+	}
+
+	// Return the i-th forest edge
+	const Edge<T>& tree_edge(int i) const {
+		return edges[tree[i]];
+	}
+
+	// Insert an edge or change its weight
+	// numeric_limits<T>::max() removes it
+	// Insertions and decreases are O(log V) amortized
+	// Increasing or removing a forest edge searches the smaller of the two
+	// split trees and its spare edges for a replacement
+	void set_edge(int, int, T);
+
+	// Remove an edge
+	void remove_edge(int, int);
+
+	// Return true if the vertices are in the same tree
+	bool connected(int, int);
+
+	// Return the heaviest edge weight on the u -> v tree path
+	// numeric_limits<T>::max() if they are not connected,
+	// numeric_limits<T>::lowest() if u == v
+	T bottleneck(int, int);
+
+};	// end - DynamicMST class
+
+#endif /* DYNAMICMST_CLASS_H_ */
@@ -0,0 +1,167 @@
+/*
+ * EdgeList.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef EDGELIST_H_
+#define EDGELIST_H_
+
+#include "EdgeList_class.h"
+
+
+// Sorting
+
+// LSD radix sort on the weight, 8 bits per pass
+template <class T>
+void sort_edges(Edge<T>* first, Edge<T>* last, true_type) {
+
+	typedef typename make_unsigned<T>::type U;
+
+	size_t n = last - first;
+	if (n < 2)
+		return;
+
+	// Flipping the sign bit orders signed weights as unsigned
+	const U flip = is_signed<T>::value ? (U) 1 << (sizeof(T) * 8 - 1) : 0;
+
+	// Scatter buffer - passes alternate between the two arrays
+	vector< Edge<T> > buffer(n);
+	Edge<T>* src = first;
+	Edge<T>* dst = buffer.data();
+
+	for (unsigned shift = 0; shift < sizeof(T) * 8; shift += 8) {
+
+		// Digit histogram
+		size_t count[256] = {0};
+		for (size_t i = 0; i < n; i++)
+			count[(((U) src[i].weight ^ flip) >> shift) & 0xFF]++;
+
+		// Skip a pass where every edge has the same digit
+		if (count[(((U) src[0].weight ^ flip) >> shift) & 0xFF] == n)
+			continue;
+
+		// Prefix sums give the first slot of each digit
+		size_t offset = 0;
+		for (int d = 0; d < 256; d++) {
+			size_t c = count[d];
+			count[d] = offset;
+			offset += c;
+		}
+
+		// Stable scatter
+		for (size_t i = 0; i < n; i++)
+			dst[count[(((U) src[i].weight ^ flip) >> shift) & 0xFF]++] = src[i];
+
+		swap(src, dst);
+	}
+
+	// Odd number of passes - the result is in the buffer
+	if (src != first)
+		copy(src, src + n, first);
+
+}	// end - sort_edges(integral)
+
+// Comparison sort for other weights
+template <class T>
+void sort_edges(Edge<T>* first, Edge<T>* last, false_type) {
+
+	stable_sort(first, last, [](const Edge<T>& a, const Edge<T>& b) {
+		return a.weight < b.weight;
+	});
+
+}	// end - sort_edges(other)
+
+// Sort edges on weight, stable
+template <class T>
+void sort_edges(Edge<T>* first, Edge<T>* last) {
+	sort_edges(first, last, typename is_integral<T>::type());
+}
+
+// Spanning forest
+
+// Kruskal - keep the edges that join two trees
+template <class T>
+vector< Edge<T> > kruskal_tree(const Edge<T>* first, const Edge<T>* last,
+							   int vertices, const int* local,
+							   vector< Edge<T> >* spares) {
+
+	// One set per vertex
+	DisjointSet sets(vertices);
+
+	vector< Edge<T> > tree;
+	tree.reserve(max(vertices - 1, 0));
+
+	// Iterate through the edges
+	for (const Edge<T>* edge = first; edge != last; edge++) {
+
+		int u = (local != nullptr) ? local[edge->u] : edge->u;
+		int v = (local != nullptr) ? local[edge->v] : edge->v;
+
+		// Merge the trees - skip if they are the same tree
+		if (!sets.merge(u, v)) {
+			if (spares != nullptr)
+				spares->push_back(*edge);
+			continue;
+		}
+
+		tree.push_back(*edge);
+
+		// If nothing remaining - exit loop
+		if ((int) tree.size() == vertices - 1 && spares == nullptr)
+			break;
+	}
+
+	return tree;
+
+}	// end - kruskal_tree()
+
+// Constructors
+
+// Empty list
+template <class T>
+EdgeList<T>::EdgeList():vertices(0) {
+}
+
+// Every non-zero matrix entry in row-major order
+template <class T>
+EdgeList<T>::EdgeList(Graph<T>& graph):vertices(graph.Vertices()) {
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	// Graph size
+	int size = graph.Vertices();
+
+	// Create the edge list
+	for (int row = 0; row < size; ++row) {
+		for (int col = 0; col < size; ++col) {
+			T cost = graph.get_edge_value(row, col);
+			if (cost != 0 && cost != infinity)
+				edges.push_back(Edge<T>{cost, row, col});
+		}
+	}
+
+}	// end - EdgeList(Graph)
+
+// Methods
+
+// Add a u-v edge
+template <class T>
+void EdgeList<T>::add(int u, int v, T weight) {
+
+	// Grow the vertex count to fit
+	vertices = max(vertices, max(u, v) + 1);
+
+	edges.push_back(Edge<T>{weight, u, v});
+
+}	// end - add()
+
+// Sort on weight, stable
+template <class T>
+void EdgeList<T>::sort() {
+	sort_edges(begin(), end());
+}
+
+#endif /* EDGELIST_H_ */
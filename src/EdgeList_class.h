@@ -0,0 +1,92 @@
+/*
+ * EdgeList_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef EDGELIST_CLASS_H_
+#define EDGELIST_CLASS_H_
+
+#include <vector>
+#include <type_traits>
+
+using namespace std;
+
+#include "Graph.h"
+#include "DisjointSet.h"
+
+
+// Packed weighted edge record - sorts on weight
+template <class T>
+struct Edge {
+	T weight;
+	int u;
+	int v;
+};
+
+// Sort edges on weight, stable - LSD radix sort for integral weights
+template <class T>
+void sort_edges(Edge<T>*, Edge<T>*);
+
+// Kruskal over edges sorted on weight - returns the edges joining two trees
+// local maps vertices to 0..vertices-1 unless nullptr
+// Every other edge goes to spares unless nullptr, else the scan stops
+// at a spanning tree
+template <class T>
+vector< Edge<T> > kruskal_tree(const Edge<T>*, const Edge<T>*, int,
+							   const int* = nullptr,
+							   vector< Edge<T> >* = nullptr);
+
+// Flat, contiguous weighted edge list
+template <class T>
+class EdgeList {
+
+private:
+
+	// Number of vertices
+	int vertices;
+
+	// The edges
+	vector< Edge<T> > edges;
+
+public:
+
+	// Empty list
+	EdgeList();
+
+	// Every non-zero matrix entry in row-major order
+	EdgeList(Graph<T>&);
+
+	// Return the number of vertices
+	int Vertices() const {
+		return vertices;
+	}
+
+	// Return the number of edges
+	int size() const {
+		return edges.size();
+	}
+
+	// Return an edge
+	Edge<T>& operator[](int e) {
+		return edges[e];
+	}
+
+	// Edge array bounds
+	Edge<T>* begin() {
+		return edges.data();
+	}
+	Edge<T>* end() {
+		return edges.data() + edges.size();
+	}
+
+	// Add a u-v edge
+	void add(int, int, T);
+
+	// Sort on weight, stable - ties keep their order
+	void sort();
+
+};	// end - EdgeList class
+
+#endif /* EDGELIST_CLASS_H_ */
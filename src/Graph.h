@@ -19,6 +19,7 @@ using namespace std;
 #include <string>
 #include <limits>
 
+#include "Workspace.h"
 #include "Graph_class.h"
 
 
@@ -28,8 +29,8 @@ using namespace std;
 template <class T>
 Graph<T>::Graph():vertices(50),
 				  edges(0),
-				  pNeighbors_list(nullptr),
-				  reach(nullptr) {
+				  version(0),
+				  pNeighbors_list(nullptr) {
 
 	// Generate the graph columns
 	graph.resize(vertices);
@@ -43,8 +44,8 @@ Graph<T>::Graph():vertices(50),
 template <class T>
 Graph<T>::Graph(const int SIZE):vertices(SIZE),
 								edges(0),
-								pNeighbors_list(nullptr),
-								reach(nullptr) {
+								version(0),
+								pNeighbors_list(nullptr) {
 
 	// Check for a valid size
 	if (SIZE < 2)
@@ -65,8 +66,8 @@ Graph<T>::Graph(const int SIZE):vertices(SIZE),
 template <class T>
 Graph<T>::Graph(int i, int j, string algorithm):vertices(i),
 												edges(0),
-												pNeighbors_list(nullptr),
-												reach(nullptr) {
+												version(0),
+												pNeighbors_list(nullptr) {
 
 	// Check for a valid size
 	if (i < 2 || j < 2)
@@ -79,20 +80,8 @@ Graph<T>::Graph(int i, int j, string algorithm):vertices(i),
 	if (!algorithm.compare(sJ))
 		vertices++;
 
-	// Generate the graph columns
-		APSPgraph.resize(vertices);
-
-	// Initialize to infinity
-	for(int i=0; i<vertices; i++)
-	{
-		APSPgraph[i].resize(vertices);
-		for(int j=0; j<vertices; j++)
-		{
-			// Only need three k planes
-			// initial, previous and
-			APSPgraph[i][j].resize(3, infinity);
-		}
-	}
+	// One in-place plane initialized to infinity
+	APSPmatrix.assign((size_t) vertices * vertices, infinity);
 
 }	// end - Graph(int, int, string)
 
@@ -100,8 +89,8 @@ Graph<T>::Graph(int i, int j, string algorithm):vertices(i),
 template <class T>
 Graph<T>::Graph(string file_name):vertices(0),
 								  edges(0),
-								  pNeighbors_list(nullptr),
-								  reach(nullptr) {
+								  version(0),
+								  pNeighbors_list(nullptr) {
 
 	// graph size
 	int size;
@@ -188,29 +177,6 @@ Graph<T>::~Graph()
 
 // Methods
 
-// Depth-first search utility method
-template <class T>
-void Graph<T>::dfsearch(int node, int &count) {
-
-	// Set initial node as reachable
-	reach[node] = 1;
-
-	// Increment the count
-	count++;
-
-	// Look for reachable nodes from here
-	for(int j = 1; j < vertices; j++) {
-		// If nodes are connected
-		if(adjacent(node, j))
-		{
-			// If not already reached
-			if(!reach[j])
-				// DFS this node
-				dfsearch(j,count);
-		}
-	}
-}
-
 // Return the number of vertices
 template <class T>
 int Graph<T>::Vertices() {
@@ -223,6 +189,12 @@ int Graph<T>::Edges() {
 	return edges;
 }
 
+// Return the edge change counter
+template <class T>
+unsigned long Graph<T>::Version() {
+	return version;
+}
+
 // Return true if vertices are adjacent
 template <class T>
 bool Graph<T>::adjacent(int x, int y) {
@@ -269,6 +241,7 @@ void Graph<T>::add(int x, int y) {
 
 	// Set the x->y value to 1
 	graph[x][y] =  1;
+	version++;
 
 	// Increment the number of edges
 	edges++;
@@ -288,6 +261,7 @@ void Graph<T>::remove(int x, int y) {
 
 	// Set the x->y value to 0
 	graph[x][y] = 0;
+	version++;
 }
 
 // Return the edge value
@@ -316,6 +290,7 @@ void Graph<T>::set_edge_value(int x, int y, T a) {
 
 	// Set the x->y value
 	graph[x][y] = a;
+	version++;
 }
 
 // Return the APSP edge value
@@ -328,8 +303,9 @@ T Graph<T>::get_APSP_edge_value(int i, int j, int k) {
 		k < 0 ||k >= 3)
 		return 0;
 
-	// Return the x->y edge value from the k plane
-	return APSPgraph[i][j][k];
+	// Return the x->y edge value
+	// All k planes share the in-place matrix
+	return APSPmatrix[(size_t) i * vertices + j];
 }
 
 // Set the APSP edge value
@@ -345,12 +321,21 @@ void Graph<T>::set_APSP_edge_value(int i, int j, int k, T dist) {
 	// Define infinity
 	long infinity = numeric_limits<long>::max();
 
+	// Row-major matrix entry
+	T& entry = APSPmatrix[(size_t) i * vertices + j];
+
 	// If the edge doesn't exist increment the edge count
-	if (APSPgraph[i][j][k] == infinity)
+	if (entry == infinity)
 		edges++;
 
 	// Set the x->y value
-	APSPgraph[i][j][k] = dist;
+	entry = dist;
+}
+
+// Return the row-major APSP distance matrix
+template <class T>
+T* Graph<T>::APSP_data() {
+	return APSPmatrix.data();
 }
 
 // Get graph density
@@ -363,23 +348,37 @@ double Graph<T>::get_density() {
 }
 
 // is_connected() method
+// Traversal in the calling thread's workspace - no per-call allocation
 template <class T>
-bool Graph<T>::is_connected(const int SIZE) {
+bool Graph<T>::is_connected() {
 
-	// Initialize the reach array
-	reach = new int[SIZE]{};
+	// Check for an empty graph
+	if (vertices < 1)
+		return false;
+
+	// Start a new query
+	Workspace<T>& ws = Workspace<T>::local();
+	ws.reset(vertices);
+
+	// Set initial node as reachable
+	ws.label(0, 0, -1);
 
-	// Initialize the count
-	int count = 0;
+	// The touched list is the breadth-first queue
+	const vector<int>& queue = ws.Touched();
+	for (size_t next = 0; next < queue.size(); next++) {
 
-	// Depth-first search of the graph
-	dfsearch(0, count);
+		int node = queue[next];
 
-	// Deallocate the reach array
-	delete [] reach;
+		// Look for reachable nodes from here
+		for (int j = 0; j < vertices; j++) {
+			// If nodes are connected and not already reached
+			if (adjacent(node, j) && !ws.reached(j))
+				ws.label(j, 0, node);
+		}
+	}
 
 	// Check result
-	if(count == vertices)
+	if((int) queue.size() == vertices)
 		return true;
 	else
 		return false;
@@ -22,21 +22,18 @@ private:
 	// Number of edges
 	int edges;
 
+	// Incremented by every edge change
+	unsigned long version;
+
 	// The Adjacency Matrix
 	vector< vector<T> > graph;
 
-	// Three dimensional Adjacency Matrix
-	vector< vector< vector<T> > > APSPgraph;
+	// All-Pairs distance matrix - contiguous, row-major
+	vector<T> APSPmatrix;
 
 	// The neighboring node list
 	list<int>* pNeighbors_list;
 
-	// Reach array for dfsearch()
-	int* reach;
-
-	// Depth-first search
-	void dfsearch(int node, int &count);
-
 public:
 
 	// APSP algorithms
@@ -55,7 +52,7 @@ public:
 	// Generates a 2-D graph of the specified size
 	Graph(const int);
 
-	// Generate a 3-D graph
+	// Generate an All-Pairs distance matrix
 	Graph(int , int, string);
 
 	// Generates a graph from data contained in the specified file
@@ -72,6 +69,9 @@ public:
 	// Return the number of edges
 	int Edges();
 
+	// Return the edge change counter
+	unsigned long Version();
+
 	// Return true if vertices are adjacent
 	bool adjacent(int, int);
 
@@ -96,11 +96,14 @@ public:
 	// Set ASPS edge value
 	void set_APSP_edge_value(int, int, int, T);
 
+	// Return the row-major APSP distance matrix
+	T* APSP_data();
+
 	// Get graph density
 	double get_density();
 
 	// is_connected() function
-	bool is_connected(const int);
+	bool is_connected();
 
 	// Print the Adjacency Matrix
 	void print_matrix(style_t);
@@ -0,0 +1,252 @@
+/*
+ * HammingCluster.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef HAMMINGCLUSTER_H_
+#define HAMMINGCLUSTER_H_
+
+#include <iostream>
+#include <fstream>
+
+#include "HammingCluster_class.h"
+
+
+// Constructors
+
+// No codes
+inline HammingCluster::HammingCluster():bits(0),
+										shift(64) {
+}
+
+// Codes of the given bit width
+inline HammingCluster::HammingCluster(const vector<uint64_t>& node_codes,
+									  int code_bits):bits(0),
+													 shift(64) {
+
+	// Check for a valid width
+	if (code_bits < 1 || code_bits > 64) {
+		cerr << "Invalid code width: " << code_bits << endl;
+		return;
+	}
+
+	bits = code_bits;
+	codes = node_codes;
+
+	// Drop anything above the code width
+	if (bits < 64)
+		for (auto &code : codes)
+			code &= (((uint64_t) 1) << bits) - 1;
+
+	index();
+
+}	// end - HammingCluster(codes)
+
+// From file
+inline HammingCluster::HammingCluster(string file_name):bits(0),
+														shift(64) {
+
+	// Setup a file stream
+	ifstream data_file(file_name);
+	if (!data_file) {
+		cerr << "Couldn't open file: " << file_name << endl;
+		return;
+	}
+
+	// Read in the number of nodes and the code width
+	int size = 0;
+	int code_bits = 0;
+	data_file >> size >> code_bits;
+
+	// Check for a valid width
+	if (code_bits < 1 || code_bits > 64) {
+		cerr << "Invalid code width: " << code_bits << endl;
+		return;
+	}
+
+	bits = code_bits;
+	codes.reserve(max(size, 0));
+
+	// Read in the codes - most significant bit first
+	for (int i = 0; i < size; i++) {
+
+		uint64_t code = 0;
+		for (int b = 0; b < bits; b++) {
+			int bit;
+			data_file >> bit;
+			code = (code << 1) | (bit & 1);
+		}
+
+		if (!data_file) {
+			cerr << "Missing code for node: " << i << endl;
+			break;
+		}
+
+		codes.push_back(code);
+	}
+
+	index();
+
+}	// end - HammingCluster(string)
+
+// Methods
+
+// Return the number of nodes
+inline int HammingCluster::Nodes() const {
+	return codes.size();
+}
+
+// Return the bits per code
+inline int HammingCluster::Bits() const {
+	return bits;
+}
+
+// Index the distinct codes
+inline void HammingCluster::index() {
+
+	// At least twice as many slots as codes
+	int slots = 2;
+	shift = 63;
+	while (slots < 2 * (int) codes.size()) {
+		slots *= 2;
+		shift--;
+	}
+	slot_code.assign(slots, 0);
+	slot_node.assign(slots, -1);
+
+	distinct.clear();
+	first.clear();
+
+	for (int i = 0; i < (int) codes.size(); i++) {
+
+		// Probe for the code or an empty slot
+		size_t slot = (codes[i] * 0x9E3779B97F4A7C15ULL) >> shift;
+		while (slot_node[slot] >= 0 && slot_code[slot] != codes[i])
+			slot = (slot + 1) & (slots - 1);
+
+		// First node with this code
+		if (slot_node[slot] < 0) {
+			slot_code[slot] = codes[i];
+			slot_node[slot] = i;
+			distinct.push_back(codes[i]);
+			first.push_back(i);
+		}
+	}
+
+}	// end - index()
+
+// First node holding a code, -1 if none
+inline int HammingCluster::lookup(uint64_t code) const {
+
+	// Nothing indexed
+	if (slot_node.empty())
+		return -1;
+
+	size_t mask = slot_node.size() - 1;
+	size_t slot = (code * 0x9E3779B97F4A7C15ULL) >> shift;
+	while (slot_node[slot] >= 0) {
+		if (slot_code[slot] == code)
+			return slot_node[slot];
+		slot = (slot + 1) & mask;
+	}
+
+	return -1;
+
+}	// end - lookup()
+
+// Merge every pair of nodes within distance d
+inline void HammingCluster::link(int d, DisjointSet& sets) {
+
+	int size = codes.size();
+
+	// Equal codes are at distance 0
+	for (int i = 0; i < size; i++)
+		sets.merge(i, lookup(codes[i]));
+
+	if (d < 1)
+		return;
+
+	// Lookups per code - sum of C(bits, r) for r = 1..d
+	double lookups = 0;
+	double choose = 1;
+	for (int r = 1; r <= min(d, bits); r++) {
+		choose = choose * (bits - r + 1) / r;
+		lookups += choose;
+	}
+
+	// Few flip neighbors - look each one up in the code index
+	if (lookups < distinct.size()) {
+		for (int i = 0; i < (int) distinct.size() && sets.Sets() > 1; i++)
+			flip(first[i], distinct[i], 0, d, sets);
+		return;
+	}
+
+	// Too many flip neighbors - compare every pair of distinct codes
+	int count = distinct.size();
+	for (int i = 0; i < count && sets.Sets() > 1; i++) {
+
+		uint64_t code = distinct[i];
+
+		for (int j = i + 1; j < count; j++)
+			if (__builtin_popcountll(code ^ distinct[j]) <= d)
+				sets.merge(first[i], first[j]);
+	}
+
+}	// end - link()
+
+// Merge with every distinct code flipped in up to left more bits
+inline void HammingCluster::flip(int node, uint64_t code, int start, int left,
+								 DisjointSet& sets) {
+
+	for (int b = start; b < bits; b++) {
+
+		uint64_t neighbor = code ^ (((uint64_t) 1) << b);
+
+		// Merge with the neighbor if some node holds it
+		int found = lookup(neighbor);
+		if (found >= 0)
+			sets.merge(node, found);
+
+		// Flip more bits above this one
+		if (left > 1)
+			flip(node, neighbor, b + 1, left - 1, sets);
+	}
+
+}	// end - flip()
+
+// Number of clusters when nodes within distance d are merged
+inline int HammingCluster::clusters(int d) {
+
+	DisjointSet sets(codes.size());
+	link(d, sets);
+
+	return sets.Sets();
+
+}	// end - clusters()
+
+// Cluster label of every node
+inline vector<int> HammingCluster::cluster_labels(int d) {
+
+	int size = codes.size();
+
+	DisjointSet sets(size);
+	link(d, sets);
+
+	// Number the roots in order of each cluster's smallest node
+	vector<int> label(size, -1);
+	vector<int> result(size);
+	int count = 0;
+	for (int i = 0; i < size; i++) {
+		int root = sets.find(i);
+		if (label[root] < 0)
+			label[root] = count++;
+		result[i] = label[root];
+	}
+
+	return result;
+
+}	// end - cluster_labels()
+
+#endif /* HAMMINGCLUSTER_H_ */
@@ -0,0 +1,81 @@
+/*
+ * HammingCluster_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef HAMMINGCLUSTER_CLASS_H_
+#define HAMMINGCLUSTER_CLASS_H_
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+using namespace std;
+
+#include "DisjointSet.h"
+
+
+// Single-linkage clustering of bit codes under Hamming distance
+// The complete graph is implicit - no edges are ever stored
+class HammingCluster {
+
+private:
+
+	// Bits per code, 1..64
+	int bits;
+
+	// One code per node
+	vector<uint64_t> codes;
+
+	// Distinct codes and the first node holding each one
+	vector<uint64_t> distinct;
+	vector<int> first;
+
+	// Open-addressing code index - power of two slots, half full at most
+	// Linear probing, -1 marks an empty slot
+	vector<uint64_t> slot_code;
+	vector<int> slot_node;
+	int shift;
+
+	// Index the distinct codes
+	void index();
+
+	// First node holding a code, -1 if none
+	int lookup(uint64_t) const;
+
+	// Merge every pair of nodes within distance d
+	void link(int, DisjointSet&);
+
+	// Merge code with every distinct code flipped in up to left more bits,
+	// flipping only bits from position start up
+	void flip(int, uint64_t, int, int, DisjointSet&);
+
+public:
+
+	// No codes
+	HammingCluster();
+
+	// Codes of the given bit width
+	HammingCluster(const vector<uint64_t>&, int);
+
+	// From file - "n bits" then n lines of bits 0/1 values
+	HammingCluster(string);
+
+	// Return the number of nodes
+	int Nodes() const;
+
+	// Return the bits per code
+	int Bits() const;
+
+	// Number of clusters when nodes within distance d are merged
+	int clusters(int);
+
+	// Cluster label 0..clusters(d)-1 of every node
+	// Labels are numbered in order of each cluster's smallest node
+	vector<int> cluster_labels(int);
+
+};	// end - HammingCluster class
+
+#endif /* HAMMINGCLUSTER_CLASS_H_ */
@@ -0,0 +1,125 @@
+/*
+ * HopMatrix.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef HOPMATRIX_H_
+#define HOPMATRIX_H_
+
+#include "HopMatrix_class.h"
+
+
+// Empty matrix
+inline HopMatrix::HopMatrix():vertices(0),
+							  width(1) {
+}
+
+// Allocate a V x V matrix of "no path" entries
+inline void HopMatrix::assign(int size) {
+
+	vertices = size;
+
+	// The all ones value is reserved for "no path"
+	if (size < 0xFF)
+		width = 1;
+	else if (size < 0xFFFF)
+		width = 2;
+	else
+		width = 4;
+
+	// Every byte 0xFF is all ones at any width
+	entries.assign((size_t) size * size * width, 0xFF);
+
+}	// end - assign()
+
+// Release the matrix
+inline void HopMatrix::clear() {
+	vertices = 0;
+	vector<unsigned char>().swap(entries);
+}
+
+// Return the number of vertices
+inline int HopMatrix::Vertices() const {
+	return vertices;
+}
+
+// Return the entry size in bytes
+inline int HopMatrix::Width() const {
+	return width;
+}
+
+// Next vertex after i on the i -> j path
+inline int HopMatrix::next(int i, int j) const {
+
+	size_t cell = (size_t) i * vertices + j;
+
+	switch (width) {
+	case 1: {
+		uint8_t hop = ((const uint8_t*) entries.data())[cell];
+		return (hop == UINT8_MAX) ? -1 : hop;
+	}
+	case 2: {
+		uint16_t hop = ((const uint16_t*) entries.data())[cell];
+		return (hop == UINT16_MAX) ? -1 : hop;
+	}
+	default: {
+		uint32_t hop = ((const uint32_t*) entries.data())[cell];
+		return (hop == UINT32_MAX) ? -1 : (int) hop;
+	}
+	}
+
+}	// end - next()
+
+// Set the next vertex after i on the i -> j path
+inline void HopMatrix::set(int i, int j, int hop) {
+
+	size_t cell = (size_t) i * vertices + j;
+
+	// -1 converts to all ones
+	switch (width) {
+	case 1:
+		((uint8_t*) entries.data())[cell] = (uint8_t) hop;
+		break;
+	case 2:
+		((uint16_t*) entries.data())[cell] = (uint16_t) hop;
+		break;
+	default:
+		((uint32_t*) entries.data())[cell] = (uint32_t) hop;
+	}
+
+}	// end - set()
+
+// Vertex list of the i -> j path
+inline list<int> HopMatrix::path(int i, int j) const {
+
+	list<int> nodes;
+
+	// Check for valid vertices
+	if (i < 0 || i >= vertices || j < 0 || j >= vertices)
+		return nodes;
+
+	// Check for a path
+	if (next(i, j) < 0)
+		return nodes;
+
+	// Follow the hops - a simple path has at most V vertices
+	nodes.push_back(i);
+	for (int v = i; v != j; ) {
+		v = next(v, j);
+		if (v < 0 || (int) nodes.size() >= vertices)
+			return list<int>();
+		nodes.push_back(v);
+	}
+
+	return nodes;
+
+}	// end - path()
+
+// Return the memory used by the matrix
+inline size_t HopMatrix::bytes() const {
+	return entries.size();
+}
+
+#endif /* HOPMATRIX_H_ */
@@ -0,0 +1,71 @@
+/*
+ * HopMatrix_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef HOPMATRIX_CLASS_H_
+#define HOPMATRIX_CLASS_H_
+
+#include <vector>
+#include <list>
+#include <cstdint>
+
+using namespace std;
+
+
+// All-pairs next-hop matrix
+// Entries are the narrowest unsigned type that fits the vertex count
+// All ones is "no path"
+class HopMatrix {
+
+private:
+
+	// Number of vertices
+	int vertices;
+
+	// Entry size in bytes - 1, 2 or 4
+	int width;
+
+	// Row-major entries
+	vector<unsigned char> entries;
+
+public:
+
+	// Empty matrix
+	HopMatrix();
+
+	// Allocate a V x V matrix of "no path" entries
+	void assign(int);
+
+	// Release the matrix
+	void clear();
+
+	// Return the number of vertices, 0 if not recorded
+	int Vertices() const;
+
+	// Return the entry size in bytes
+	int Width() const;
+
+	// Return the entries as the index type matching Width()
+	template <class I>
+	I* data() {
+		return (I*) entries.data();
+	}
+
+	// Next vertex after i on the i -> j path, -1 if none
+	int next(int, int) const;
+
+	// Set the next vertex after i on the i -> j path, -1 for none
+	void set(int, int, int);
+
+	// Vertex list of the i -> j path, empty if none
+	list<int> path(int, int) const;
+
+	// Return the memory used by the matrix
+	size_t bytes() const;
+
+};	// end - HopMatrix class
+
+#endif /* HOPMATRIX_CLASS_H_ */
@@ -0,0 +1,110 @@
+/*
+ * IndexedHeap.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef INDEXEDHEAP_H_
+#define INDEXEDHEAP_H_
+
+#include "IndexedHeap_class.h"
+
+
+// Heap over vertices [0, size)
+template <class K>
+IndexedHeap<K>::IndexedHeap(int size):position(size, -1),
+									  keys(size) {
+	heap.reserve(size);
+}
+
+// Insert a vertex, or lower its key if it's already in the heap
+template <class K>
+void IndexedHeap<K>::push(int v, K key) {
+
+	// Already queued - only ever decrease
+	if (position[v] >= 0) {
+		if (key < keys[v]) {
+			keys[v] = key;
+			sift_up(position[v]);
+		}
+		return;
+	}
+
+	keys[v] = key;
+	position[v] = heap.size();
+	heap.push_back(v);
+	sift_up(position[v]);
+
+}	// end - push()
+
+// Remove and return the vertex with the smallest key
+template <class K>
+int IndexedHeap<K>::pop() {
+
+	int top = heap[0];
+
+	// Move the last vertex to the root
+	swap_nodes(0, heap.size() - 1);
+	heap.pop_back();
+	position[top] = -1;
+
+	if (!heap.empty())
+		sift_down(0);
+
+	return top;
+
+}	// end - pop()
+
+// Restore the heap order upward from a position
+template <class K>
+void IndexedHeap<K>::sift_up(int i) {
+
+	while (i > 0) {
+		int parent = (i - 1) / 2;
+		if (!(keys[heap[i]] < keys[heap[parent]]))
+			break;
+		swap_nodes(i, parent);
+		i = parent;
+	}
+
+}	// end - sift_up()
+
+// Restore the heap order downward from a position
+template <class K>
+void IndexedHeap<K>::sift_down(int i) {
+
+	int n = heap.size();
+
+	while (true) {
+
+		// Smallest of the node and its children
+		int smallest = i;
+		int left = 2 * i + 1;
+		int right = left + 1;
+
+		if (left < n && keys[heap[left]] < keys[heap[smallest]])
+			smallest = left;
+		if (right < n && keys[heap[right]] < keys[heap[smallest]])
+			smallest = right;
+
+		if (smallest == i)
+			break;
+
+		swap_nodes(i, smallest);
+		i = smallest;
+	}
+
+}	// end - sift_down()
+
+// Swap two heap positions
+template <class K>
+void IndexedHeap<K>::swap_nodes(int i, int j) {
+
+	swap(heap[i], heap[j]);
+	position[heap[i]] = i;
+	position[heap[j]] = j;
+
+}	// end - swap_nodes()
+
+#endif /* INDEXEDHEAP_H_ */
@@ -0,0 +1,72 @@
+/*
+ * IndexedHeap_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef INDEXEDHEAP_CLASS_H_
+#define INDEXEDHEAP_CLASS_H_
+
+#include <vector>
+
+using namespace std;
+
+
+// Indexed binary min-heap of vertices keyed by K
+// Each vertex is in the heap at most once, so keys can be decreased in place
+template <class K>
+class IndexedHeap {
+
+private:
+
+	// Heap of vertices
+	vector<int> heap;
+
+	// Heap position of each vertex, -1 if not in the heap
+	vector<int> position;
+
+	// Key of each vertex in the heap
+	vector<K> keys;
+
+	// Restore the heap order upward / downward from a position
+	void sift_up(int);
+	void sift_down(int);
+
+	// Swap two heap positions
+	void swap_nodes(int, int);
+
+public:
+
+	// Heap over vertices [0, size)
+	IndexedHeap(int);
+
+	// Return true if the heap is empty
+	bool empty() const {
+		return heap.empty();
+	}
+
+	// Return the number of vertices in the heap
+	int size() const {
+		return heap.size();
+	}
+
+	// Return true if the vertex is in the heap
+	bool contains(int v) const {
+		return position[v] >= 0;
+	}
+
+	// Return the key of a vertex in the heap
+	K key(int v) const {
+		return keys[v];
+	}
+
+	// Insert a vertex, or lower its key if it's already in the heap
+	void push(int, K);
+
+	// Remove and return the vertex with the smallest key
+	int pop();
+
+};	// end - IndexedHeap class
+
+#endif /* INDEXEDHEAP_CLASS_H_ */
@@ -14,13 +14,16 @@
 // Calculate the minimum-spanning-tree distance
 // An implementation of the Jarnik-Prim algorithm
 template <class T>
-void MST<T>::PrimMST(Graph<T> graph) {
+void MST<T>::PrimMST(Graph<T>& graph) {
 
-	// Initialize the number of vertices
-	int vertices = graph.Vertices();
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
 
-	// Initialize the node visited array
-	vector<bool> visited(vertices, false);
+	// Undirected adjacency list - only real neighbors are scanned
+	AdjacencyList<T> adjacency(graph, true);
+
+	// Initialize the number of vertices
+	int vertices = adjacency.Vertices();
 
 	// Generate MST edge list if necessary
 	if (pMSTEdge_list == nullptr)
@@ -29,115 +32,141 @@ void MST<T>::PrimMST(Graph<T> graph) {
 	else
 		pMSTEdge_list->clear();
 
-	// Number of edges in the MST
-	int num_edges = 0;
+	// Initialize the total distance
+	mst_distance = 0;
 
-	// Start at the first vertex
-	visited[0] = true;
+	// Check for a valid graph
+	if (vertices < 2)
+		return;
 
-	// While were are not done
-	while(num_edges < vertices - 1){
+	// Initialize the node visited array
+	vector<bool> visited(vertices, false);
 
-		// Initialize to large value
-		int min_dist = 999999;
+	// Cheapest crossing edge into each vertex
+	vector<T> min_dist(vertices, infinity);
+	vector<int> min_from(vertices, -1);
 
-		// Indices of the minimum edge nodes
-		int min_from , min_to;
+	// Vertices keyed on their cheapest crossing edge
+	IndexedHeap<T> heap(vertices);
 
-		// Loop through the nodes
-		for(int from = 0; from < vertices; ++from) {
+	// Number of trees grown
+	int trees = 0;
 
-			// If node has been visited
-			if(visited[from]) {
+	// Grow a tree from every vertex not reached yet
+	for (int start = 0; start < vertices; start++) {
 
-				// Look for adjacent nodes
-				for(int to = 0; to < vertices; ++to){
+		if (visited[start])
+			continue;
 
-					// If this node has not been selected
-					if(!visited[to]) {
+		trees++;
+		min_dist[start] = 0;
+		heap.push(start, 0);
 
-						int edge_distance = graph.get_edge_value(from, to);
+		// Until nothing is reachable
+		while (!heap.empty()) {
 
-						// If this is a smaller (non-zero) distance
-						if (edge_distance && (edge_distance <= min_dist)) {
+			// Closest unvisited node
+			int to = heap.pop();
 
-							// Set as new minimum
-							min_dist = edge_distance;
+			// Indicate this node has been visited
+			visited[to] = true;
 
-							// Save this node info
-							min_from = from;
-							min_to = to;
-						}
-					}
-				}
-			}
-		}
+			// Put the crossing edge into the edge list
+			if (min_from[to] >= 0) {
+				pMSTEdge_list->push_back(MST(min_from[to], to, min_dist[to]));
 
-		// Indicate this node has been visited
-		visited[min_to] = true;
+				// Increment the MST distance
+				mst_distance += min_dist[to];
+			}
 
-		// Put this node into the edge list
-		pMSTEdge_list->push_back(MST(min_from, min_to, min_dist));
+			// Update the crossing edges of the unvisited neighbors
+			for (int e = adjacency.out_begin(to); e < adjacency.out_end(to); e++) {
 
-		// Increment the MST distance
-		mst_distance += min_dist;
+				int next = adjacency.head(e);
+				T edge_distance = adjacency.weight(e);
 
-		// Increment the number of MST edges
-		num_edges += 1;
+				if (!visited[next] && edge_distance < min_dist[next]) {
+					min_dist[next] = edge_distance;
+					min_from[next] = to;
+					heap.push(next, edge_distance);
+				}
+			}
+		}
 	}
 
+	// More than one tree - no spanning tree, the edge list is the forest
+	if (trees > 1)
+		mst_distance = numeric_limits<T>::max();
+
 }	// end - PrimMST()
 
 
 // Calculate the minimum-spanning-tree distance
 // An implementation of the Kruskal algorithm
 template <class T>
-void MST<T>::create_set(vector<T>& pRank, vector<T>& pParent, int x) {
-	pRank.at(x) = 0;
-	pParent.at(x) = x;
-}
+void MST<T>::KruskalMST(Graph<T>& graph) {
 
-template <class T>
-T MST<T>::find_set(vector<T>& pParent, int x) {
-	T at_x = pParent.at(x);
-	if (x != at_x)
-		pParent.at(x) = find_set(pParent, at_x);
+	const bool DEBUG = false;
+//	const bool DEBUG = true;
 
-	return pParent.at(x);
-}
+	// The edge list
+	EdgeList<T> edges(graph);
 
-template <class T>
-void MST<T>::merge_set(vector<T>& pRank, vector<T>& pParent, int x, int y) {
-	T at_x = pRank.at(x);
-	T at_y = pRank.at(y);
-	if (at_x > at_y)
-		pParent.at(y) = x;
+	// Graph size
+	int size = graph.Vertices();
+
+	// Generate MST edge list if necessary
+	if (pMSTEdge_list == nullptr)
+		pMSTEdge_list = new list<MST>;
 	else
-		pParent.at(x) = y;
+		pMSTEdge_list->clear();
 
-	if (at_x == at_y)
-		pRank.at(y) += 1;
-}
+	// Initialize the total distance
+	mst_distance = 0;
 
-template <class T>
-void MST<T>::KruskalMST(Graph<T> graph) {
+	// Sort the edges
+	edges.sort();
 
-	const bool DEBUG = false;
-//	const bool DEBUG = true;
+	if (DEBUG) {
+		for (auto &edge : edges) {
+			cout << edge.u
+				 << "->"
+				 << edge.v
+				 << ":"
+				 << edge.weight
+				 << endl;
+		}
+	}
+
+	// Iterate through the tree edges
+	for (auto& edge : kruskal_tree(edges.begin(), edges.end(), size)) {
+
+		// Put this node into the edge list
+		pMSTEdge_list->push_back(MST(edge.u, edge.v, edge.weight));
+
+		// Accumulate the total cost
+		mst_distance += edge.weight;
+	}
+
+	// If anything remaining - no MST, the edge list is the forest
+	if ((int) pMSTEdge_list->size() < size - 1)
+		mst_distance = numeric_limits<T>::max();
+
+}	// end - KruskalMST()
+
+// Calculate the minimum-spanning-tree distance
+// Filter-Kruskal - only edges that still cross components get sorted
+template <class T>
+void MST<T>::FilterKruskalMST(Graph<T>& graph) {
 
 	// The edge list
-	list< pair<T, pair<T, T>> > edges;
+	EdgeList<T> edges(graph);
 
 	// Graph size
 	int size = graph.Vertices();
 
-	// Generate necessary structures
-	vector<T> rank(size, 0);
-	vector<T> parent(size);
-
-	// Initialize the parent vector
-	for (int i = 0; i < size; ++i)
-		parent[i] = i;
+	// One set per vertex
+	DisjointSet sets(size);
 
 	// Generate MST edge list if necessary
 	if (pMSTEdge_list == nullptr)
@@ -151,88 +180,383 @@ void MST<T>::KruskalMST(Graph<T> graph) {
 	// Initialize the remaining node count
 	int remaining = size - 1;
 
-	// Create the edge list
-	for (int row = 0; row < size; ++row) {
-		for (int col = 0; col < size; ++col) {
-			if (int cost = graph.get_edge_value(row, col))
-				edges.push_back((make_pair(cost, make_pair(row, col))));
-		}
+	// Partition, filter and sort
+	filter_kruskal(edges.begin(), edges.end(), sets, remaining);
+
+	// If anything remaining - no MST, the edge list is the forest
+	if (remaining)
+		mst_distance = numeric_limits<T>::max();
+
+}	// end - FilterKruskalMST()
+
+// Filter-Kruskal over the edges [first, last)
+template <class T>
+void MST<T>::filter_kruskal(Edge<T>* first, Edge<T>* last,
+							DisjointSet& sets, int& remaining) {
+
+	// Small enough to sort directly
+	const int THRESHOLD = 4096;
+
+	// Nothing left to do
+	if (first == last || !remaining)
+		return;
+
+	// Pivot - median of three weights
+	Edge<T>* middle = first + (last - first) / 2;
+	T a = first->weight;
+	T b = middle->weight;
+	T c = (last - 1)->weight;
+	T pivot = max(min(a, b), min(max(a, b), c));
+
+	// Light edges first
+	Edge<T>* split = last;
+	if (last - first > THRESHOLD) {
+		split = partition(first, last,
+						  [&](const Edge<T>& e) { return e.weight <= pivot; });
+
+		// Pivot is the largest weight - split off the pivot weight instead
+		if (split == last)
+			split = partition(first, last,
+							  [&](const Edge<T>& e) { return e.weight < pivot; });
+
+		// Every weight is equal
+		if (split == first)
+			split = last;
 	}
 
-	// Create the parent set
-	for(int i = 0; i < size; ++i)
-		create_set(rank, parent, i);
+	// Base case - sort and run Kruskal
+	if (split == last) {
 
-	// Sort the edges
-	edges.sort();
+		sort_edges(first, last);
 
-	if (DEBUG) {
-		for (auto &edge : edges) {
-			cout << edge.second.first
-				 << "->"
-				 << edge.second.second
-				 << ":"
-				 << edge.first
-				 << endl;
+		// Iterate through the edges
+		for (Edge<T>* edge = first; edge != last; edge++) {
+
+			// Merge the trees - skip if they are the same tree
+			if (!sets.merge(edge->u, edge->v))
+				continue;
+
+			// Put this node into the edge list
+			pMSTEdge_list->push_back(MST(edge->u, edge->v, edge->weight));
+
+			// Accumulate the total cost
+			mst_distance += edge->weight;
+
+			// If nothing remaining - exit loop
+			if (!--remaining)
+				break;
 		}
+
+		return;
+	}
+
+	// Light edges first
+	filter_kruskal(first, split, sets, remaining);
+
+	// Drop the heavy edges inside a component
+	Edge<T>* keep = partition(split, last, [&](const Edge<T>& e) {
+		return !sets.same(e.u, e.v);
+	});
+
+	// Then the heavy edges that still cross components
+	filter_kruskal(split, keep, sets, remaining);
+
+}	// end - filter_kruskal()
+
+// Calculate the minimum-spanning-tree distance
+// External-memory Kruskal - sorted runs in temporary files, k-way merged
+template <class T>
+void MST<T>::ExternalKruskalMST(string file_name, bool binary, size_t run_edges) {
+
+	// Generate MST edge list if necessary
+	if (pMSTEdge_list == nullptr)
+		pMSTEdge_list = new list<MST>;
+	else
+		pMSTEdge_list->clear();
+
+	// Initialize the total distance
+	mst_distance = 0;
+
+	// At least one edge per run
+	if (run_edges < 1)
+		run_edges = 1;
+
+	// Setup a file stream
+	ifstream data_file(file_name, binary ? ios::binary : ios::in);
+	if (!data_file) {
+		cerr << "Couldn't open file: " << file_name << endl;
+		return;
 	}
 
-	// Iterate through the edges
-	for (auto& edge : edges) {
+	// Read in the number of vertices
+	int size = 0;
+	if (binary)
+		data_file.read((char*) &size, sizeof(size));
+	else {
+		long edge_count;
+		data_file >> size >> edge_count;
+	}
+
+	// Check for a valid size
+	if (size < 2)
+		return;
+
+	// Runs merged per pass - bounds the read buffers, not the open files
+	const size_t MERGE_WAYS = 64;
+
+	// Current run
+	vector< Edge<T> > run;
+	run.reserve(run_edges);
 
-		// Find the parent nodes
-		T u = find_set(parent, edge.second.first);
-		T v = find_set(parent, edge.second.second);
+	// Spilled runs as (first edge, edge count) in one temporary file
+	FILE* runs_file = nullptr;
+	vector< pair<size_t, size_t> > runs;
+	size_t spilled = 0;
 
-		// If they are in the same tree - skip
-		if (u == v)
+	// Sort the current run and append it to the run file
+	auto spill = [&]() {
+
+		sort_edges(run.data(), run.data() + run.size());
+
+		if (runs_file == nullptr)
+			runs_file = tmpfile();
+		if (runs_file == nullptr ||
+			fwrite(run.data(), sizeof(Edge<T>), run.size(), runs_file) != run.size()) {
+			cerr << "Couldn't write a temporary run file" << endl;
+			return false;
+		}
+
+		runs.push_back(make_pair(spilled, run.size()));
+		spilled += run.size();
+		run.clear();
+		return true;
+	};
+
+	// Close the run file
+	auto close_runs = [&]() {
+		if (runs_file != nullptr)
+			fclose(runs_file);
+		runs_file = nullptr;
+	};
+
+	// Stream the edges into sorted runs
+	while (true) {
+
+		// Get the graph nodes and the edge value
+		int x, y;
+		T value;
+		if (binary) {
+			data_file.read((char*) &x, sizeof(x));
+			data_file.read((char*) &y, sizeof(y));
+			data_file.read((char*) &value, sizeof(value));
+		}
+		else
+			data_file >> x >> y >> value;
+		if (!data_file)
+			break;
+
+		// Convert to zero-based graph
+		x--;
+		y--;
+
+		// Check validity
+		if (x < 0 || x >= size || y < 0 || y >= size) {
+			cerr << "Invalid graph node: " << x << ":" << y << endl;
+			close_runs();
+			return;
+		}
+
+		// 0 is a missing edge, as in Graph
+		if (value == 0)
 			continue;
 
-		// Merge the trees
-		merge_set(rank, parent, u, v);
+		run.push_back(Edge<T>{value, x, y});
+
+		// Spill a full run
+		if (run.size() == run_edges && !spill()) {
+			close_runs();
+			return;
+		}
+	}
+
+	// Spill the last run unless everything fit in memory
+	if (!runs.empty() && !run.empty() && !spill()) {
+		close_runs();
+		return;
+	}
+	if (runs.empty())
+		sort_edges(run.data(), run.data() + run.size());
+
+	// Release the run buffer before merging
+	if (!runs.empty())
+		vector< Edge<T> >().swap(run);
+
+	// Read buffer per merged run
+	size_t buffer_edges = max((size_t) 1, run_edges / MERGE_WAYS);
+	buffer_edges = min(buffer_edges, (size_t) 65536);
+
+	// k-way merge of runs [first, last) of a file through small read buffers
+	// Stops early when output(edge) returns false
+	auto merge = [&](FILE* file, size_t first, size_t last,
+					 function<bool(const Edge<T>&)> output) {
+
+		int ways = last - first;
+		vector< vector< Edge<T> > > buffer(ways);
+		vector<size_t> position(ways, 0);
+
+		// Edges of each run not yet read
+		vector<size_t> next_edge(ways);
+		vector<size_t> left(ways);
+		for (int r = 0; r < ways; r++) {
+			next_edge[r] = runs[first + r].first;
+			left[r] = runs[first + r].second;
+		}
+
+		// Refill a run's buffer, false at the end of the run
+		auto refill = [&](int r) {
+			size_t want = min(buffer_edges, left[r]);
+			buffer[r].resize(want);
+			size_t got = 0;
+			if (want > 0 &&
+				fseek(file, (long) (next_edge[r] * sizeof(Edge<T>)), SEEK_SET) == 0)
+				got = fread(buffer[r].data(), sizeof(Edge<T>), want, file);
+			buffer[r].resize(got);
+			next_edge[r] += got;
+			left[r] -= got;
+			position[r] = 0;
+			return got > 0;
+		};
+
+		// Min-queue of (weight, run) - ties in run order keep the file order
+		priority_queue< pair<T, int>,
+						vector< pair<T, int> >,
+						greater< pair<T, int> > > queue;
+
+		for (int r = 0; r < ways; r++)
+			if (refill(r))
+				queue.push(make_pair(buffer[r][0].weight, r));
+
+		while (!queue.empty()) {
+
+			int r = queue.top().second;
+			queue.pop();
+
+			if (!output(buffer[r][position[r]++]))
+				return;
+
+			// Next edge of this run
+			if (position[r] < buffer[r].size() || refill(r))
+				queue.push(make_pair(buffer[r][position[r]].weight, r));
+		}
+	};
+
+	// Merge groups of MERGE_WAYS runs into a new file until one pass is left
+	while (runs.size() > MERGE_WAYS) {
+
+		FILE* merged_file = tmpfile();
+		if (merged_file == nullptr) {
+			cerr << "Couldn't write a temporary run file" << endl;
+			close_runs();
+			return;
+		}
+
+		// Write buffer for the merged runs
+		vector< Edge<T> > out;
+		out.reserve(buffer_edges);
+		bool written = true;
+		auto flush = [&]() {
+			if (fwrite(out.data(), sizeof(Edge<T>), out.size(), merged_file) != out.size())
+				written = false;
+			out.clear();
+		};
+
+		vector< pair<size_t, size_t> > merged;
+		size_t total = 0;
+
+		for (size_t first = 0; first < runs.size() && written; first += MERGE_WAYS) {
+
+			size_t last = min(first + MERGE_WAYS, runs.size());
+			size_t start = total;
+
+			merge(runs_file, first, last, [&](const Edge<T>& edge) {
+				out.push_back(edge);
+				if (out.size() == buffer_edges)
+					flush();
+				total++;
+				return written;
+			});
+			flush();
+
+			merged.push_back(make_pair(start, total - start));
+		}
+
+		// The merged runs replace the inputs
+		close_runs();
+		runs_file = merged_file;
+		runs.swap(merged);
+
+		if (!written) {
+			cerr << "Couldn't write a temporary run file" << endl;
+			close_runs();
+			return;
+		}
+	}
+
+	// One set per vertex
+	DisjointSet sets(size);
+
+	// Initialize the remaining node count
+	int remaining = size - 1;
+
+	// Add an edge if it joins two trees
+	auto take = [&](const Edge<T>& edge) {
+
+		// Merge the trees - skip if they are the same tree
+		if (!sets.merge(edge.u, edge.v))
+			return;
 
 		// Put this node into the edge list
-		pMSTEdge_list->push_back(MST(edge.second.first,
-									 edge.second.second,
-									 edge.first));
+		pMSTEdge_list->push_back(MST(edge.u, edge.v, edge.weight));
 
 		// Accumulate the total cost
-		mst_distance += edge.first;
+		mst_distance += edge.weight;
 
-		// If nothing remaining - exit loop
-		if (!--remaining)
-			break;
+		remaining--;
+	};
+
+	// Everything fit in one in-memory run
+	if (runs.empty()) {
+		for (size_t e = 0; e < run.size() && remaining; e++)
+			take(run[e]);
 	}
+	// Final merge pass straight into the tree
+	else
+		merge(runs_file, 0, runs.size(), [&](const Edge<T>& edge) {
+			take(edge);
+			return remaining > 0;
+		});
 
-	// If anything remaining - no MST
+	close_runs();
+
+	// If anything remaining - no MST, the edge list is the forest
 	if (remaining)
-		mst_distance = numeric_limits<int>::infinity();
+		mst_distance = numeric_limits<T>::max();
 
-}	// end - KruskalMST()
+}	// end - ExternalKruskalMST()
 
+// Calculate the minimum-spanning-tree distance
+// Parallel Boruvka - every component picks its lightest outgoing edge,
+// the picks are linked by CAS, repeat for O(log V) rounds
 template <class T>
-T MST<T>::k_Cluster(Graph<T> graph, int k) {
+void MST<T>::BoruvkaMST(Graph<T>& graph, int threads) {
 
-//	const bool DEBUG = false;
-	const bool DEBUG = true;
-
-	// The edge list
-	list< pair<T, pair<T, T>> > edges;
+	// The edge list - row-major, so the index breaks weight ties like Kruskal
+	EdgeList<T> edges(graph);
+	int count = edges.size();
 
 	// Graph size
 	int size = graph.Vertices();
 
-	// Maximum spacing
-	T maximum_spacing = 1000000;
-
-	// Generate necessary structures
-	vector<T> rank(size, 0);
-	vector<T> parent(size);
-
-	// Initialize the parent vector
-	for (int i = 0; i < size; ++i)
-		parent[i] = i;
-
 	// Generate MST edge list if necessary
 	if (pMSTEdge_list == nullptr)
 		pMSTEdge_list = new list<MST>;
@@ -242,78 +566,216 @@ T MST<T>::k_Cluster(Graph<T> graph, int k) {
 	// Initialize the total distance
 	mst_distance = 0;
 
+	// Check for a valid graph
+	if (size < 2)
+		return;
+
+	// Worker threads
+	ThreadPool pool(threads);
+	int workers = pool.Threads();
+
+	// Components - linked concurrently
+	ConcurrentDisjointSet components(size);
+
+	// Lightest outgoing edge of each component, -1 if none
+	vector< atomic<int> > best(size);
+
+	// Edges picked by each thread in a round
+	vector< vector<int> > picked(workers);
+
+	// Total order on edges - (weight, index)
+	auto lighter = [&](int a, int b) {
+		return edges[a].weight < edges[b].weight ||
+			   (edges[a].weight == edges[b].weight && a < b);
+	};
+
 	// Initialize the remaining node count
-	T remaining = size - 1;
+	int remaining = size - 1;
+
+	while (remaining) {
+
+		// Lightest outgoing edge of each component
+		pool.run([&](int id) {
+
+			for (int c = id; c < size; c += workers)
+				best[c] = -1;
+		});
+
+		pool.run([&](int id) {
+
+			int first = (long) count * id / workers;
+			int last = (long) count * (id + 1) / workers;
+
+			for (int e = first; e < last; e++) {
+
+				// Parents are flat between rounds
+				int cu = components.find(edges[e].u);
+				int cv = components.find(edges[e].v);
+
+				// Skip edges inside a component
+				if (cu == cv)
+					continue;
+
+				// Lower both components' picks
+				for (int c : {cu, cv}) {
+					int current = best[c];
+					while ((current == -1 || lighter(e, current)) &&
+						   !best[c].compare_exchange_weak(current, e));
+				}
+			}
+		});
+
+		// Link the picks - an edge picked by both ends is linked once
+		pool.run([&](int id) {
+
+			picked[id].clear();
+
+			for (int c = id; c < size; c += workers) {
+
+				int e = best[c];
+				if (e == -1)
+					continue;
+
+				// Link the two components unless the other end already did
+				if (components.merge(edges[e].u, edges[e].v))
+					picked[id].push_back(e);
+			}
+		});
+
+		// Flatten the parents for the next round
+		pool.run([&](int id) {
+
+			for (int v = id; v < size; v += workers)
+				components.flatten(v);
+		});
+
+		// Collect the round's edges in edge order
+		vector<int> round;
+		for (auto &p : picked)
+			round.insert(round.end(), p.begin(), p.end());
+		sort(round.begin(), round.end());
 
-	// Create the edge list
-	for (int row = 0; row < size; ++row) {
-		for (int col = 0; col < size; ++col) {
-			if (int cost = graph.get_edge_value(row, col))
-				edges.push_back((make_pair(cost, make_pair(row, col))));
+		// No outgoing edges - disconnected
+		if (round.empty())
+			break;
+
+		for (int e : round) {
+
+			// Put this node into the edge list
+			pMSTEdge_list->push_back(MST(edges[e].u, edges[e].v, edges[e].weight));
+
+			// Accumulate the total cost
+			mst_distance += edges[e].weight;
+
+			remaining--;
 		}
 	}
 
-	// Create the parent set
-	for(int i = 0; i < size; ++i)
-		create_set(rank, parent, i);
+	// If anything remaining - no MST, the edge list is the forest
+	if (remaining)
+		mst_distance = numeric_limits<T>::max();
 
-	// Sort the edges
-	edges.sort();
+}	// end - BoruvkaMST()
 
-	if (DEBUG) {
-		for (auto &edge : edges) {
-			cout << edge.second.first
-				 << "->"
-				 << edge.second.second
-				 << ":"
-				 << edge.first
-				 << endl;
-		}
-		cout << endl;
+// Print the Boruvka thread scaling from 1 to max_threads
+template <class T>
+void MST<T>::print_Boruvka_scaling(Graph<T>& graph, int max_threads) {
+
+	// Single thread time
+	double base = 0;
+
+	cout << "Boruvka scaling (" << graph.Vertices() << " vertices, "
+		 << graph.Edges() << " edges):" << endl << endl;
+
+	for (int t=1; t<=max_threads; t++) {
+
+		// Time one run
+		auto begin = chrono::steady_clock::now();
+		BoruvkaMST(graph, t);
+		auto end = chrono::steady_clock::now();
+		double ms = chrono::duration<double, milli>(end - begin).count();
+
+		if (t == 1)
+			base = ms;
+
+		// Print the threads, time, speedup and efficiency
+		cout << "threads = " << t
+			 << "  time = " << ms << " ms"
+			 << "  speedup = " << base / ms
+			 << "  efficiency = " << 100.0 * base / (ms * t) << "%"
+			 << "  distance = " << mst_distance << endl;
 	}
+	cout << endl;
 
-	// Iterate through the edges
-	for (auto& edge : edges) {
+}	// end - print_Boruvka_scaling()
 
-		// Find the parent nodes
-		T u = find_set(parent, edge.second.first);
-		T v = find_set(parent, edge.second.second);
+// Calculate the minimum-spanning-forest distance
+template <class T>
+SpanningForest<T> MST<T>::ForestMST(Graph<T>& graph, int threads) {
 
-		// If they are in the same tree - skip
-		if (u == v)
-			continue;
+	// Per-component trees
+	SpanningForest<T> forest(graph, threads);
+
+	// Generate MST edge list if necessary
+	if (pMSTEdge_list == nullptr)
+		pMSTEdge_list = new list<MST>;
+	else
+		pMSTEdge_list->clear();
 
-		// Merge the trees
-		merge_set(rank, parent, u, v);
+	// Initialize the total distance
+	mst_distance = 0;
 
-		// Put this node into the edge list
-		pMSTEdge_list->push_back(MST(edge.second.first,
-									 edge.second.second,
-									 edge.first));
+	// Put every component's tree into the edge list
+	for (int c = 0; c < forest.Components(); c++) {
 
-		// Accumulate the total cost
-		mst_distance += edge.first;
+		for (auto &edge : forest.edges(c))
+			pMSTEdge_list->push_back(MST(edge.u, edge.v, edge.weight));
 
-		// If k clusters remain - exit loop
-		if (--remaining == k-1)
-			break;
+		// Accumulate the total cost
+		mst_distance += forest.distance(c);
 	}
 
-	// Loop through the edges
-	for (auto &edge : edges) {
+	return forest;
 
-		// Skip if they have the same parent
-		if (find_set(parent, edge.second.first) == find_set(parent, edge.second.second))
-			continue;
+}	// end - ForestMST()
+
+template <class T>
+T MST<T>::k_Cluster(Graph<T>& graph, int k) {
+
+	const bool DEBUG = false;
+//	const bool DEBUG = true;
+
+	// Single-linkage merge order
+	Dendrogram<T> dendrogram(graph);
 
-		// Check for smaller distance
-		if (edge.first < maximum_spacing)
-			maximum_spacing = edge.first;
+	// Generate MST edge list if necessary
+	if (pMSTEdge_list == nullptr)
+		pMSTEdge_list = new list<MST>;
+	else
+		pMSTEdge_list->clear();
+
+	// Initialize the total distance
+	mst_distance = 0;
+
+	// Merges applied for k clusters
+	int applied = dendrogram.Vertices() - dendrogram.clusters(k);
+
+	// Put the applied merges into the edge list
+	for (int i = 0; i < applied; i++) {
+
+		auto &merge = dendrogram.Merges()[i];
 
+		if (DEBUG)
+			cout << merge.u << "->" << merge.v << ":" << merge.weight << endl;
+
+		pMSTEdge_list->push_back(MST(merge.u, merge.v, merge.weight));
+
+		// Accumulate the total cost
+		mst_distance += merge.weight;
 	}
 
 	// Return the maximum spacing
-	return maximum_spacing;
+	return dendrogram.max_spacing(k);
 
 }	// end - k_cluster()
 
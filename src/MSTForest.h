@@ -0,0 +1,289 @@
+/*
+ * MSTForest.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef MSTFOREST_H_
+#define MSTFOREST_H_
+
+#include <limits>
+#include <algorithm>
+
+#include "MSTForest_class.h"
+
+
+// Constructors
+
+// Empty forest
+template <class T>
+MSTForest<T>::MSTForest():vertices(0),
+						  levels(1) {
+}
+
+// Minimum spanning forest of a graph
+template <class T>
+MSTForest<T>::MSTForest(Graph<T>& graph):vertices(graph.Vertices()),
+										 levels(1) {
+
+	// The sorted edge list
+	EdgeList<T> edges(graph);
+	edges.sort();
+
+	// Kruskal - keep the edges that join two trees
+	build(kruskal_tree(edges.begin(), edges.end(), vertices));
+
+}	// end - MSTForest(Graph)
+
+// Forest of the given tree edges
+template <class T>
+MSTForest<T>::MSTForest(int size, const vector< Edge<T> >& tree):
+											vertices(max(size, 0)),
+											levels(1) {
+
+	// Skip edges with invalid vertices
+	vector< Edge<T> > valid;
+	valid.reserve(tree.size());
+	for (auto &edge : tree)
+		if (check_node(edge.u) && check_node(edge.v))
+			valid.push_back(edge);
+
+	build(valid);
+
+}	// end - MSTForest(size, tree)
+
+// Methods
+
+// Root the forest and build the lifting index
+template <class T>
+void MSTForest<T>::build(const vector< Edge<T> >& tree) {
+
+	// Levels so that 2^levels > V
+	levels = 1;
+	while ((1 << levels) < vertices)
+		levels++;
+
+	// Compact adjacency - neighbors of v at [start[v], start[v + 1])
+	vector<int> start(vertices + 1, 0);
+	for (auto &edge : tree) {
+		start[edge.u + 1]++;
+		start[edge.v + 1]++;
+	}
+	for (int v = 0; v < vertices; v++)
+		start[v + 1] += start[v];
+
+	vector<int> fill(start.begin(), start.end() - 1);
+	vector<int> neighbor(start[vertices]);
+	vector<T> edge_weight(start[vertices]);
+	for (auto &edge : tree) {
+		neighbor[fill[edge.u]] = edge.v;
+		edge_weight[fill[edge.u]++] = edge.weight;
+		neighbor[fill[edge.v]] = edge.u;
+		edge_weight[fill[edge.v]++] = edge.weight;
+	}
+
+	// Root each tree at its smallest vertex, breadth-first
+	parent.assign(vertices, -1);
+	weight.assign(vertices, T());
+	depth.assign(vertices, 0);
+	root.assign(vertices, -1);
+
+	vector<int> queue;
+	queue.reserve(vertices);
+	for (int r = 0; r < vertices; r++) {
+
+		// Already in a tree
+		if (root[r] >= 0)
+			continue;
+
+		parent[r] = r;
+		root[r] = r;
+		queue.push_back(r);
+
+		for (size_t next = queue.size() - 1; next < queue.size(); next++) {
+
+			int u = queue[next];
+
+			for (int i = start[u]; i < start[u + 1]; i++) {
+				int v = neighbor[i];
+				if (root[v] >= 0)
+					continue;
+				parent[v] = u;
+				weight[v] = edge_weight[i];
+				depth[v] = depth[u] + 1;
+				root[v] = r;
+				queue.push_back(v);
+			}
+		}
+	}
+
+	// Level 0 - one step up
+	up.assign((size_t) levels * vertices, 0);
+	best.assign((size_t) levels * vertices, -1);
+	for (int v = 0; v < vertices; v++) {
+		up[v] = parent[v];
+		best[v] = (parent[v] == v) ? -1 : v;
+	}
+
+	// Level k - two level k-1 jumps
+	for (int k = 1; k < levels; k++) {
+
+		size_t row = (size_t) k * vertices;
+		size_t previous = row - vertices;
+
+		for (int v = 0; v < vertices; v++) {
+			int middle = up[previous + v];
+			up[row + v] = up[previous + middle];
+			best[row + v] = heavier(best[previous + v], best[previous + middle]);
+		}
+	}
+
+}	// end - build()
+
+// Heavier of two parent edges, -1 for none
+template <class T>
+int MSTForest<T>::heavier(int a, int b) const {
+
+	if (a < 0)
+		return b;
+	if (b < 0)
+		return a;
+
+	return (weight[b] > weight[a]) ? b : a;
+
+}	// end - heavier()
+
+// Return true if the vertex is in the forest
+template <class T>
+bool MSTForest<T>::check_node(int v) const {
+
+	// Check validity
+	if (v < 0 || v >= vertices) {
+		cerr << "Invalid graph node: " << v << endl;
+		return false;
+	}
+
+	return true;
+
+}	// end - check_node()
+
+// Vertex with the heaviest parent edge on the u -> v path
+template <class T>
+int MSTForest<T>::path_max(int u, int v) const {
+
+	// Not connected or no edges
+	if (u == v || root[u] != root[v])
+		return -1;
+
+	int result = -1;
+
+	// Lift the deeper vertex to the same depth
+	if (depth[u] < depth[v])
+		swap(u, v);
+	int lift = depth[u] - depth[v];
+	for (int k = 0; lift; k++, lift >>= 1)
+		if (lift & 1) {
+			result = heavier(result, best[(size_t) k * vertices + u]);
+			u = up[(size_t) k * vertices + u];
+		}
+
+	if (u == v)
+		return result;
+
+	// Lift both to just below the common ancestor
+	for (int k = levels - 1; k >= 0; k--) {
+
+		size_t row = (size_t) k * vertices;
+		if (up[row + u] == up[row + v])
+			continue;
+
+		result = heavier(result, best[row + u]);
+		result = heavier(result, best[row + v]);
+		u = up[row + u];
+		v = up[row + v];
+	}
+
+	// The last step up on both sides
+	result = heavier(result, u);
+	result = heavier(result, v);
+
+	return result;
+
+}	// end - path_max()
+
+// Return the heaviest edge weight on the u -> v tree path
+template <class T>
+T MSTForest<T>::bottleneck(int u, int v) const {
+
+	// Check validity
+	if (!check_node(u) || !check_node(v))
+		return numeric_limits<T>::max();
+
+	if (u == v)
+		return numeric_limits<T>::lowest();
+
+	int heaviest = path_max(u, v);
+	if (heaviest < 0)
+		return numeric_limits<T>::max();
+
+	return weight[heaviest];
+
+}	// end - bottleneck()
+
+// Return the heaviest edge on the u -> v tree path
+template <class T>
+Edge<T> MSTForest<T>::bottleneck_edge(int u, int v) const {
+
+	// Check validity
+	if (!check_node(u) || !check_node(v))
+		return Edge<T>{numeric_limits<T>::max(), -1, -1};
+
+	int heaviest = path_max(u, v);
+	if (heaviest < 0)
+		return Edge<T>{bottleneck(u, v), -1, -1};
+
+	return Edge<T>{weight[heaviest], heaviest, parent[heaviest]};
+
+}	// end - bottleneck_edge()
+
+// Return the u -> v minimax path
+template <class T>
+vector<int> MSTForest<T>::minimax_path(int u, int v) const {
+
+	vector<int> path;
+
+	// Check validity
+	if (!check_node(u) || !check_node(v))
+		return path;
+
+	// Not connected
+	if (root[u] != root[v])
+		return path;
+
+	// Climb both ends to the common ancestor
+	vector<int> tail;
+	while (depth[u] > depth[v]) {
+		path.push_back(u);
+		u = parent[u];
+	}
+	while (depth[v] > depth[u]) {
+		tail.push_back(v);
+		v = parent[v];
+	}
+	while (u != v) {
+		path.push_back(u);
+		tail.push_back(v);
+		u = parent[u];
+		v = parent[v];
+	}
+
+	// The ancestor, then the v side top down
+	path.push_back(u);
+	path.insert(path.end(), tail.rbegin(), tail.rend());
+
+	return path;
+
+}	// end - minimax_path()
+
+#endif /* MSTFOREST_H_ */
@@ -0,0 +1,112 @@
+/*
+ * MSTForest_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef MSTFOREST_CLASS_H_
+#define MSTFOREST_CLASS_H_
+
+#include <vector>
+
+using namespace std;
+
+#include "Graph.h"
+#include "EdgeList.h"
+#include "DisjointSet.h"
+
+
+// Minimum spanning forest as a rooted parent array
+// A binary-lifting index answers bottleneck (heaviest edge) queries on any
+// tree path in O(log V) - the minimax path weight between two vertices
+template <class T>
+class MSTForest {
+
+private:
+
+	// Number of vertices
+	int vertices;
+
+	// Number of lifting levels
+	int levels;
+
+	// Parent of each vertex, roots point to themselves
+	vector<int> parent;
+
+	// Weight of each vertex's parent edge
+	vector<T> weight;
+
+	// Depth below the tree root
+	vector<int> depth;
+
+	// Tree root of each vertex
+	vector<int> root;
+
+	// 2^k-th ancestor of v at [k * V + v]
+	vector<int> up;
+
+	// Vertex with the heaviest parent edge on that jump, -1 if none
+	vector<int> best;
+
+	// Root the forest and build the lifting index
+	void build(const vector< Edge<T> >&);
+
+	// Heavier of two parent edges, -1 for none
+	int heavier(int, int) const;
+
+	// Vertex with the heaviest parent edge on the u -> v path
+	// -1 if not connected or u == v
+	int path_max(int, int) const;
+
+	// Return true if the vertex is in the forest, else print an error
+	bool check_node(int) const;
+
+public:
+
+	// Empty forest
+	MSTForest();
+
+	// Minimum spanning forest of a graph - Kruskal once
+	MSTForest(Graph<T>&);
+
+	// Forest of the given tree edges
+	// Edges with invalid vertices are skipped with an error
+	MSTForest(int, const vector< Edge<T> >&);
+
+	// Return the number of vertices
+	int Vertices() const {
+		return vertices;
+	}
+
+	// Return the parent of a vertex, itself for a root, -1 if invalid
+	int get_parent(int v) const {
+		return check_node(v) ? parent[v] : -1;
+	}
+
+	// Return the weight of a vertex's parent edge
+	// numeric_limits<T>::max() if invalid
+	T get_weight(int v) const {
+		return check_node(v) ? weight[v] : numeric_limits<T>::max();
+	}
+
+	// Return true if the vertices are in the same tree
+	bool connected(int u, int v) const {
+		return check_node(u) && check_node(v) && root[u] == root[v];
+	}
+
+	// Return the heaviest edge weight on the u -> v tree path
+	// numeric_limits<T>::max() if they are not connected or invalid,
+	// numeric_limits<T>::lowest() if u == v
+	T bottleneck(int, int) const;
+
+	// Return the heaviest edge on the u -> v tree path
+	// Weight as bottleneck(), endpoints -1 if there is no such edge
+	Edge<T> bottleneck_edge(int, int) const;
+
+	// Return the u -> v minimax path, empty if not connected or invalid
+	vector<int> minimax_path(int, int) const;
+
+};	// end - MSTForest class
+
+#endif /* MSTFOREST_CLASS_H_ */
@@ -9,10 +9,24 @@
 #define MST_CLASS_H_
 
 #include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <queue>
 
 using namespace std;
 
 #include "Graph.h"
+#include "AdjacencyList.h"
+#include "IndexedHeap.h"
+#include "EdgeList.h"
+#include "ThreadPool.h"
+#include "DisjointSet.h"
+#include "Dendrogram.h"
+#include "HammingCluster.h"
+#include "DynamicMST.h"
+#include "MSTForest.h"
+#include "SpanningForest.h"
 
 
 // Template class for the MST Node list
@@ -31,6 +45,9 @@ private:
 	// The MST node list
 	list<MST>* pMSTEdge_list;
 
+	// Filter-Kruskal recursion over an edge range
+	void filter_kruskal(Edge<T>*, Edge<T>*, DisjointSet&, int&);
+
 public:
 
 	// MST Algorithm
@@ -67,21 +84,58 @@ public:
 		return distance;
 	}
 
+	// Return the minimum-spanning-tree distance
+	// numeric_limits<T>::max() if the graph is disconnected
+	T get_mst_distance() {
+		return mst_distance;
+	}
+
 	// Calculate the minimum-spanning-tree distance
 	// An implementation of the Jarnik-Prim algorithm
-	void PrimMST(Graph<T>);
+	// Indexed heap over the undirected adjacency list, O(E log V)
+	void PrimMST(Graph<T>&);
 
 	// Calculate the minimum-spanning-tree distance
 	// An implementation of the Kruskal algorithm
-	void KruskalMST(Graph<T>);
+	// Flat edge array, radix sorted for integral weights
+	// DynamicMST keeps the tree up to date under edge changes instead
+	// MSTForest holds it as a parent array with bottleneck queries
+	void KruskalMST(Graph<T>&);
+
+	// Calculate the minimum-spanning-tree distance
+	// Filter-Kruskal - partitions around a pivot weight and drops heavy
+	// edges inside a component before they are ever sorted
+	void FilterKruskalMST(Graph<T>&);
+
+	// Calculate the minimum-spanning-tree distance
+	// External-memory Kruskal straight from an edge file
+	// Sorted runs of at most run_edges edges spill to a temporary file and
+	// are merged 64 at a time in passes, only the O(V) union-find state
+	// and the merge buffers stay in memory
+	// Text: "vertices edges" then 1-based "u v weight" lines
+	// Binary: int vertices, then 1-based (int u, int v, T weight) records
+	void ExternalKruskalMST(string, bool, size_t);
+
+	// Calculate the minimum-spanning-tree distance
+	// Parallel Boruvka on the specified number of threads, 0 = hardware
+	// Ties break on (weight, u, v) - the same tree as Kruskal
+	void BoruvkaMST(Graph<T>&, int);
+
+	// Print the Boruvka thread scaling from 1 to max_threads
+	void print_Boruvka_scaling(Graph<T>&, int);
+
+	// Calculate the minimum-spanning-forest distance
+	// Components are labeled and their trees built in parallel on the
+	// specified number of threads, 0 = hardware
+	// The edge list holds every component's tree, the distance is the sum
+	// Return the per-component trees and distances
+	SpanningForest<T> ForestMST(Graph<T>&, int);
 
 	// Generate k clusters
 	// Return maximum spacing
-	T k_Cluster(Graph<T>, int);
-
-	void create_set(vector<T>&, vector<T>&, int);
-	void merge_set(vector<T>&, vector<T>&, int, int);
-	T find_set(vector<T>&, int);
+	// Build a Dendrogram once instead to sweep k
+	// HammingCluster clusters bit codes without a Graph
+	T k_Cluster(Graph<T>&, int);
 
 
 	// Print the Minimum-Spanning-Tree
@@ -9,12 +9,49 @@ using namespace std;
 
 #include "MST.h"
 #include "ShortestPath.h"
+#include "ContractionHierarchy.h"
 
+#include <cstdlib>
 
 
-int main() {
+// Benchmark driver
+// Usage: Graph <graph file> [max threads]
+int main(int argc, char* argv[]) {
+
+	if (argc < 2) {
+		cerr << "Usage: " << argv[0] << " <graph file> [max threads]" << endl;
+		return 1;
+	}
+
+	string filename = argv[1];
+
+	// Scale from 1 to max threads, default hardware threads
+	int max_threads = ThreadPool::hardware_threads();
+	if (argc > 2)
+		max_threads = atoi(argv[2]);
+	if (max_threads < 1) {
+		cerr << "Invalid thread count: " << argv[2] << endl;
+		return 1;
+	}
+
+	// All-Pairs Shortest Path thread scaling
+	ShortestPath<long> apsp(filename, "Floyd-Warshall");
+	if (apsp.getGraphSize() < 2) {
+		cerr << "Invalid graph file: " << filename << endl;
+		return 1;
+	}
+
+	apsp.print_APSP_scaling(max_threads);
+	cout << endl;
+	apsp.print_APSP_scaling(max_threads, apsp.sMP);
+	cout << endl;
+
+	// Minimum-spanning-tree thread scaling
+	Graph<long> graph(filename);
+	MST<long> mst;
+	mst.print_Boruvka_scaling(graph, max_threads);
 
 	// Return OK
-	return 1;
+	return 0;
 
 }	// end - Main()
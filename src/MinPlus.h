@@ -0,0 +1,711 @@
+/*
+ * MinPlus.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef MINPLUS_H_
+#define MINPLUS_H_
+
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+// x86 SIMD kernels are compiled per function and picked at run time, so
+// the build needs no -mavx2 / -mavx512f
+#if (defined(__GNUC__) || defined(__clang__)) && \
+	(defined(__x86_64__) || defined(__i386__))
+#define MINPLUS_SIMD
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+
+// Min-plus (tropical) kernels over row-major distance matrices
+// numeric_limits<T>::max() is infinity and saturates: inf + x = inf
+// Integral sums saturate too - a finite sum past max() is infinity and
+// one below lowest() is lowest()
+
+// Source limits for dst[j] = min(dst[j], dik + src[j])
+// src >= high sums to infinity, src < low sums to lowest()
+template <class T>
+inline void minplus_limits(T dik, T& high, T& low) {
+
+	high = numeric_limits<T>::max();
+	low = numeric_limits<T>::lowest();
+
+	// Only integral sums can wrap
+	if (!numeric_limits<T>::is_integer)
+		return;
+
+	if (dik > 0)
+		high = numeric_limits<T>::max() - dik;
+	else if (dik < 0)
+		low = numeric_limits<T>::lowest() - dik;
+
+}	// end - minplus_limits()
+
+// Portable row kernel
+// dst[j] = min(dst[j], dik + src[j]) for j in [0, len)
+// dik must not be infinity
+template <class T>
+inline void minplus_row_scalar(T* dst, const T* src, T dik, int len) {
+
+	// Define infinity
+	const T infinity = numeric_limits<T>::max();
+	const T lowest = numeric_limits<T>::lowest();
+
+	T high, low;
+	minplus_limits(dik, high, low);
+
+	// Branch-free so the compiler can vectorize it
+	for (int j = 0; j < len; j++) {
+		T s = src[j];
+		T sum = (s >= high) ? infinity : ((s < low) ? lowest : (T) (dik + s));
+		dst[j] = (sum < dst[j]) ? sum : dst[j];
+	}
+
+}	// end - minplus_row_scalar()
+
+#ifdef MINPLUS_SIMD
+
+// 32-bit AVX2 kernel - 8 lanes
+__attribute__((target("avx2")))
+inline void minplus_row_avx2(int32_t* dst, const int32_t* src,
+							 int32_t dik, int len) {
+
+	int32_t high, low;
+	minplus_limits(dik, high, low);
+
+	const __m256i infinity = _mm256_set1_epi32(numeric_limits<int32_t>::max());
+	const __m256i lowest = _mm256_set1_epi32(numeric_limits<int32_t>::lowest());
+	const __m256i vdik = _mm256_set1_epi32(dik);
+	const __m256i vhigh = _mm256_set1_epi32(high - 1);
+	const __m256i vlow = _mm256_set1_epi32(low);
+
+	int j = 0;
+	for (; j + 8 <= len; j += 8) {
+		__m256i s = _mm256_loadu_si256((const __m256i*) (src + j));
+		__m256i d = _mm256_loadu_si256((const __m256i*) (dst + j));
+		__m256i sum = _mm256_add_epi32(s, vdik);
+		sum = _mm256_blendv_epi8(sum, infinity, _mm256_cmpgt_epi32(s, vhigh));
+		sum = _mm256_blendv_epi8(sum, lowest, _mm256_cmpgt_epi32(vlow, s));
+		_mm256_storeu_si256((__m256i*) (dst + j), _mm256_min_epi32(d, sum));
+	}
+
+	// Remainder
+	minplus_row_scalar(dst + j, src + j, dik, len - j);
+
+}	// end - minplus_row_avx2(32)
+
+// 64-bit AVX2 kernel - 4 lanes, no 64-bit min so compare and blend
+__attribute__((target("avx2")))
+inline void minplus_row_avx2(int64_t* dst, const int64_t* src,
+							 int64_t dik, int len) {
+
+	int64_t high, low;
+	minplus_limits(dik, high, low);
+
+	const __m256i infinity = _mm256_set1_epi64x(numeric_limits<int64_t>::max());
+	const __m256i lowest = _mm256_set1_epi64x(numeric_limits<int64_t>::lowest());
+	const __m256i vdik = _mm256_set1_epi64x(dik);
+	const __m256i vhigh = _mm256_set1_epi64x(high - 1);
+	const __m256i vlow = _mm256_set1_epi64x(low);
+
+	int j = 0;
+	for (; j + 4 <= len; j += 4) {
+		__m256i s = _mm256_loadu_si256((const __m256i*) (src + j));
+		__m256i d = _mm256_loadu_si256((const __m256i*) (dst + j));
+		__m256i sum = _mm256_add_epi64(s, vdik);
+		sum = _mm256_blendv_epi8(sum, infinity, _mm256_cmpgt_epi64(s, vhigh));
+		sum = _mm256_blendv_epi8(sum, lowest, _mm256_cmpgt_epi64(vlow, s));
+		d = _mm256_blendv_epi8(d, sum, _mm256_cmpgt_epi64(d, sum));
+		_mm256_storeu_si256((__m256i*) (dst + j), d);
+	}
+
+	// Remainder
+	minplus_row_scalar(dst + j, src + j, dik, len - j);
+
+}	// end - minplus_row_avx2(64)
+
+// 32-bit AVX-512 kernel - 16 lanes, masked moves saturate the sums
+__attribute__((target("avx512f")))
+inline void minplus_row_avx512(int32_t* dst, const int32_t* src,
+							   int32_t dik, int len) {
+
+	int32_t high, low;
+	minplus_limits(dik, high, low);
+
+	const __m512i infinity = _mm512_set1_epi32(numeric_limits<int32_t>::max());
+	const __m512i lowest = _mm512_set1_epi32(numeric_limits<int32_t>::lowest());
+	const __m512i vdik = _mm512_set1_epi32(dik);
+	const __m512i vhigh = _mm512_set1_epi32(high);
+	const __m512i vlow = _mm512_set1_epi32(low);
+
+	int j = 0;
+	for (; j + 16 <= len; j += 16) {
+		__m512i s = _mm512_loadu_si512((const void*) (src + j));
+		__m512i d = _mm512_loadu_si512((const void*) (dst + j));
+		__m512i sum = _mm512_add_epi32(s, vdik);
+		sum = _mm512_mask_mov_epi32(sum, _mm512_cmpge_epi32_mask(s, vhigh), infinity);
+		sum = _mm512_mask_mov_epi32(sum, _mm512_cmplt_epi32_mask(s, vlow), lowest);
+		// Masked form - the unmasked min trips -Wmaybe-uninitialized
+		d = _mm512_mask_min_epi32(d, (__mmask16) -1, d, sum);
+		_mm512_storeu_si512((void*) (dst + j), d);
+	}
+
+	// Remainder
+	minplus_row_scalar(dst + j, src + j, dik, len - j);
+
+}	// end - minplus_row_avx512(32)
+
+// 64-bit AVX-512 kernel - 8 lanes
+__attribute__((target("avx512f")))
+inline void minplus_row_avx512(int64_t* dst, const int64_t* src,
+							   int64_t dik, int len) {
+
+	int64_t high, low;
+	minplus_limits(dik, high, low);
+
+	const __m512i infinity = _mm512_set1_epi64(numeric_limits<int64_t>::max());
+	const __m512i lowest = _mm512_set1_epi64(numeric_limits<int64_t>::lowest());
+	const __m512i vdik = _mm512_set1_epi64(dik);
+	const __m512i vhigh = _mm512_set1_epi64(high);
+	const __m512i vlow = _mm512_set1_epi64(low);
+
+	int j = 0;
+	for (; j + 8 <= len; j += 8) {
+		__m512i s = _mm512_loadu_si512((const void*) (src + j));
+		__m512i d = _mm512_loadu_si512((const void*) (dst + j));
+		__m512i sum = _mm512_add_epi64(s, vdik);
+		sum = _mm512_mask_mov_epi64(sum, _mm512_cmpge_epi64_mask(s, vhigh), infinity);
+		sum = _mm512_mask_mov_epi64(sum, _mm512_cmplt_epi64_mask(s, vlow), lowest);
+		d = _mm512_mask_min_epi64(d, (__mmask8) -1, d, sum);
+		_mm512_storeu_si512((void*) (dst + j), d);
+	}
+
+	// Remainder
+	minplus_row_scalar(dst + j, src + j, dik, len - j);
+
+}	// end - minplus_row_avx512(64)
+
+#endif
+
+// SIMD level of this CPU - 0 none, 1 AVX2, 2 AVX-512
+inline int minplus_simd_level() {
+
+#ifdef MINPLUS_SIMD
+	// Checked once
+	static const int level = __builtin_cpu_supports("avx512f") ? 2 :
+							 __builtin_cpu_supports("avx2") ? 1 : 0;
+	return level;
+#else
+	return 0;
+#endif
+
+}	// end - minplus_simd_level()
+
+// Row kernel on the widest SIMD the CPU has
+// Signed 32/64-bit weights (int, long, long long) take the SIMD kernels
+template <class I>
+inline void minplus_row_simd(I* dst, const I* src, I dik, int len) {
+
+#ifdef MINPLUS_SIMD
+	int level = minplus_simd_level();
+	if (level == 2) {
+		minplus_row_avx512(dst, src, dik, len);
+		return;
+	}
+	if (level == 1) {
+		minplus_row_avx2(dst, src, dik, len);
+		return;
+	}
+#endif
+
+	minplus_row_scalar(dst, src, dik, len);
+
+}	// end - minplus_row_simd()
+
+// Signed integral weights - route on the width
+template <class T>
+inline void minplus_row(T* dst, const T* src, T dik, int len, true_type) {
+
+	if (sizeof(T) == sizeof(int32_t))
+		minplus_row_simd((int32_t*) dst, (const int32_t*) src, (int32_t) dik, len);
+	else if (sizeof(T) == sizeof(int64_t))
+		minplus_row_simd((int64_t*) dst, (const int64_t*) src, (int64_t) dik, len);
+	else
+		minplus_row_scalar(dst, src, dik, len);
+
+}	// end - minplus_row(signed)
+
+// Any other weight type
+template <class T>
+inline void minplus_row(T* dst, const T* src, T dik, int len, false_type) {
+	minplus_row_scalar(dst, src, dik, len);
+}
+
+// dst[j] = min(dst[j], dik + src[j]) for j in [0, len)
+// dik must not be infinity
+template <class T>
+inline void minplus_row(T* dst, const T* src, T dik, int len) {
+	minplus_row(dst, src, dik, len,
+				integral_constant<bool, is_integral<T>::value &&
+										is_signed<T>::value>());
+}
+
+// Next-hop tracking row kernel
+// dst[j] = min(dst[j], dik + src[j]), dnext[j] = hop where dst[j] got shorter
+template <class T, class I>
+inline void minplus_row(T* dst, I* dnext, const T* src, T dik, I hop, int len) {
+
+	// Define infinity
+	const T infinity = numeric_limits<T>::max();
+	const T lowest = numeric_limits<T>::lowest();
+
+	T high, low;
+	minplus_limits(dik, high, low);
+
+	// Branch-free so the compiler can vectorize it
+	for (int j = 0; j < len; j++) {
+		T s = src[j];
+		T sum = (s >= high) ? infinity : ((s < low) ? lowest : (T) (dik + s));
+		bool shorter = sum < dst[j];
+		dst[j] = shorter ? sum : dst[j];
+		dnext[j] = shorter ? hop : dnext[j];
+	}
+
+}	// end - minplus_row(next)
+
+// One Floyd-Warshall tile update of an n x n matrix
+// D[i][j] = min(D[i][j], D[i][k] + D[k][j])
+// for i in [i0, i1), j in [j0, j1), k in [k0, k1)
+template <class T>
+inline void minplus_fw_block(T* D, int n,
+							 int i0, int i1,
+							 int j0, int j1,
+							 int k0, int k1) {
+
+	// Define infinity
+	const T infinity = numeric_limits<T>::max();
+
+	for (int k = k0; k < k1; k++) {
+
+		// Pivot row segment
+		const T* pivot = D + (size_t) k * n + j0;
+
+		for (int i = i0; i < i1; i++) {
+
+			// Nothing to relax through an unreachable pivot
+			T dik = D[(size_t) i * n + k];
+			if (dik == infinity)
+				continue;
+
+			minplus_row(D + (size_t) i * n + j0, pivot, dik, j1 - j0);
+		}
+	}
+
+}	// end - minplus_fw_block()
+
+// Floyd-Warshall tile update that also tracks the next-hop matrix N
+// N[i][j] = N[i][k] where D[i][j] got shorter through k
+template <class T, class I>
+inline void minplus_fw_block(T* D, I* N, int n,
+							 int i0, int i1,
+							 int j0, int j1,
+							 int k0, int k1) {
+
+	// Define infinity
+	const T infinity = numeric_limits<T>::max();
+
+	for (int k = k0; k < k1; k++) {
+
+		// Pivot row segment
+		const T* pivot = D + (size_t) k * n + j0;
+
+		for (int i = i0; i < i1; i++) {
+
+			// Nothing to relax through an unreachable pivot
+			size_t ik = (size_t) i * n + k;
+			if (D[ik] == infinity)
+				continue;
+
+			minplus_row(D + (size_t) i * n + j0, N + (size_t) i * n + j0,
+						pivot, D[ik], N[ik], j1 - j0);
+		}
+	}
+
+}	// end - minplus_fw_block(next)
+
+// Register tiles of the min-plus product - 4 C rows by a few vectors of
+// columns stay in registers across the k loop, so each B row segment is
+// loaded once for 4 rows and C once per tile instead of once per k
+
+// Tile constants of one A entry - dik, high and low at stride 4, see
+// minplus_limits()
+// An unreachable entry saturates every sum to infinity
+template <class T>
+inline void minplus_tile_limits(T aik, T* limit) {
+
+	if (aik == numeric_limits<T>::max()) {
+		limit[0] = 0;
+		limit[4] = numeric_limits<T>::lowest();
+		limit[8] = numeric_limits<T>::lowest();
+		return;
+	}
+
+	limit[0] = aik;
+	minplus_limits(aik, limit[4], limit[8]);
+
+}	// end - minplus_tile_limits()
+
+// Portable tile kernel - one row at a time
+// C[r][j] = min(C[r][j], A[r][k] + B[k][j]) for r in [0, 4), j in [0, len)
+// B row k is pivot[k] + col, limit holds 12 constants per k
+template <class T>
+inline void minplus_tile_scalar(T* C, int n, const T* const* pivot, int col,
+								const T* limit, int depth, int len) {
+
+	// Define infinity
+	const T infinity = numeric_limits<T>::max();
+	const T lowest = numeric_limits<T>::lowest();
+
+	for (int r = 0; r < 4; r++) {
+
+		T* row = C + (size_t) r * n;
+
+		for (int k = 0; k < depth; k++) {
+
+			const T* src = pivot[k] + col;
+			T dik = limit[12 * k + r];
+			T high = limit[12 * k + 4 + r];
+			T low = limit[12 * k + 8 + r];
+
+			for (int j = 0; j < len; j++) {
+				T s = src[j];
+				T sum = (s >= high) ? infinity : ((s < low) ? lowest : (T) (dik + s));
+				row[j] = (sum < row[j]) ? sum : row[j];
+			}
+		}
+	}
+
+}	// end - minplus_tile_scalar()
+
+#ifdef MINPLUS_SIMD
+
+// One saturated AVX2 step - c = min(c, dik + s), constants at limit[0, 4, 8]
+// Sums from s >= high are infinity and never lower c, so they're masked
+// out - an unreachable row has high = lowest and changes nothing
+// max(s, low) + dik is lowest exactly when s < low
+__attribute__((target("avx2")))
+inline __m256i minplus_step_avx2(__m256i c, __m256i s, const int32_t* limit) {
+
+	__m256i sum = _mm256_add_epi32(_mm256_max_epi32(s, _mm256_set1_epi32(limit[8])),
+								   _mm256_set1_epi32(limit[0]));
+	__m256i keep = _mm256_cmpgt_epi32(_mm256_set1_epi32(limit[4]), s);
+	return _mm256_blendv_epi8(c, _mm256_min_epi32(c, sum), keep);
+
+}	// end - minplus_step_avx2(32)
+
+// 64-bit - no 64-bit max or min in AVX2, so compare and blend
+__attribute__((target("avx2")))
+inline __m256i minplus_step_avx2(__m256i c, __m256i s, const int64_t* limit) {
+
+	__m256i sum = _mm256_add_epi64(s, _mm256_set1_epi64x(limit[0]));
+	sum = _mm256_blendv_epi8(_mm256_set1_epi64x(numeric_limits<int64_t>::max()), sum,
+							 _mm256_cmpgt_epi64(_mm256_set1_epi64x(limit[4]), s));
+	sum = _mm256_blendv_epi8(sum, _mm256_set1_epi64x(numeric_limits<int64_t>::lowest()),
+							 _mm256_cmpgt_epi64(_mm256_set1_epi64x(limit[8]), s));
+	return _mm256_blendv_epi8(c, sum, _mm256_cmpgt_epi64(c, sum));
+
+}	// end - minplus_step_avx2(64)
+
+// AVX2 tile - 4 rows by 2 vectors
+template <class I>
+__attribute__((target("avx2")))
+inline void minplus_tile_avx2(I* C, int n, const I* const* pivot, int col,
+							  const I* limit, int depth) {
+
+	const int lanes = 32 / sizeof(I);
+	I* c0 = C;
+	I* c1 = C + (size_t) n;
+	I* c2 = C + (size_t) 2 * n;
+	I* c3 = C + (size_t) 3 * n;
+
+	__m256i c00 = _mm256_loadu_si256((const __m256i*) c0);
+	__m256i c01 = _mm256_loadu_si256((const __m256i*) (c0 + lanes));
+	__m256i c10 = _mm256_loadu_si256((const __m256i*) c1);
+	__m256i c11 = _mm256_loadu_si256((const __m256i*) (c1 + lanes));
+	__m256i c20 = _mm256_loadu_si256((const __m256i*) c2);
+	__m256i c21 = _mm256_loadu_si256((const __m256i*) (c2 + lanes));
+	__m256i c30 = _mm256_loadu_si256((const __m256i*) c3);
+	__m256i c31 = _mm256_loadu_si256((const __m256i*) (c3 + lanes));
+
+	for (int k = 0; k < depth; k++, limit += 12) {
+
+		const I* src = pivot[k] + col;
+		__m256i b0 = _mm256_loadu_si256((const __m256i*) src);
+		__m256i b1 = _mm256_loadu_si256((const __m256i*) (src + lanes));
+
+		c00 = minplus_step_avx2(c00, b0, limit);
+		c01 = minplus_step_avx2(c01, b1, limit);
+		c10 = minplus_step_avx2(c10, b0, limit + 1);
+		c11 = minplus_step_avx2(c11, b1, limit + 1);
+		c20 = minplus_step_avx2(c20, b0, limit + 2);
+		c21 = minplus_step_avx2(c21, b1, limit + 2);
+		c30 = minplus_step_avx2(c30, b0, limit + 3);
+		c31 = minplus_step_avx2(c31, b1, limit + 3);
+	}
+
+	_mm256_storeu_si256((__m256i*) c0, c00);
+	_mm256_storeu_si256((__m256i*) (c0 + lanes), c01);
+	_mm256_storeu_si256((__m256i*) c1, c10);
+	_mm256_storeu_si256((__m256i*) (c1 + lanes), c11);
+	_mm256_storeu_si256((__m256i*) c2, c20);
+	_mm256_storeu_si256((__m256i*) (c2 + lanes), c21);
+	_mm256_storeu_si256((__m256i*) c3, c30);
+	_mm256_storeu_si256((__m256i*) (c3 + lanes), c31);
+
+}	// end - minplus_tile_avx2()
+
+// One saturated AVX-512 step - masked like minplus_step_avx2()
+__attribute__((target("avx512f")))
+inline __m512i minplus_step_avx512(__m512i c, __m512i s, const int32_t* limit) {
+
+	// Masked form - the unmasked max trips -Wmaybe-uninitialized
+	__m512i low = _mm512_mask_max_epi32(s, (__mmask16) -1, s, _mm512_set1_epi32(limit[8]));
+	__m512i sum = _mm512_add_epi32(low, _mm512_set1_epi32(limit[0]));
+	__mmask16 keep = _mm512_cmplt_epi32_mask(s, _mm512_set1_epi32(limit[4]));
+	return _mm512_mask_min_epi32(c, keep, c, sum);
+
+}	// end - minplus_step_avx512(32)
+
+__attribute__((target("avx512f")))
+inline __m512i minplus_step_avx512(__m512i c, __m512i s, const int64_t* limit) {
+
+	__m512i low = _mm512_mask_max_epi64(s, (__mmask8) -1, s, _mm512_set1_epi64(limit[8]));
+	__m512i sum = _mm512_add_epi64(low, _mm512_set1_epi64(limit[0]));
+	__mmask8 keep = _mm512_cmplt_epi64_mask(s, _mm512_set1_epi64(limit[4]));
+	return _mm512_mask_min_epi64(c, keep, c, sum);
+
+}	// end - minplus_step_avx512(64)
+
+// AVX-512 tile - 4 rows by 2 vectors
+template <class I>
+__attribute__((target("avx512f")))
+inline void minplus_tile_avx512(I* C, int n, const I* const* pivot, int col,
+								const I* limit, int depth) {
+
+	const int lanes = 64 / sizeof(I);
+	I* c0 = C;
+	I* c1 = C + (size_t) n;
+	I* c2 = C + (size_t) 2 * n;
+	I* c3 = C + (size_t) 3 * n;
+
+	__m512i c00 = _mm512_loadu_si512((const void*) c0);
+	__m512i c01 = _mm512_loadu_si512((const void*) (c0 + lanes));
+	__m512i c10 = _mm512_loadu_si512((const void*) c1);
+	__m512i c11 = _mm512_loadu_si512((const void*) (c1 + lanes));
+	__m512i c20 = _mm512_loadu_si512((const void*) c2);
+	__m512i c21 = _mm512_loadu_si512((const void*) (c2 + lanes));
+	__m512i c30 = _mm512_loadu_si512((const void*) c3);
+	__m512i c31 = _mm512_loadu_si512((const void*) (c3 + lanes));
+
+	for (int k = 0; k < depth; k++, limit += 12) {
+
+		const I* src = pivot[k] + col;
+		__m512i b0 = _mm512_loadu_si512((const void*) src);
+		__m512i b1 = _mm512_loadu_si512((const void*) (src + lanes));
+
+		c00 = minplus_step_avx512(c00, b0, limit);
+		c01 = minplus_step_avx512(c01, b1, limit);
+		c10 = minplus_step_avx512(c10, b0, limit + 1);
+		c11 = minplus_step_avx512(c11, b1, limit + 1);
+		c20 = minplus_step_avx512(c20, b0, limit + 2);
+		c21 = minplus_step_avx512(c21, b1, limit + 2);
+		c30 = minplus_step_avx512(c30, b0, limit + 3);
+		c31 = minplus_step_avx512(c31, b1, limit + 3);
+	}
+
+	_mm512_storeu_si512((void*) c0, c00);
+	_mm512_storeu_si512((void*) (c0 + lanes), c01);
+	_mm512_storeu_si512((void*) c1, c10);
+	_mm512_storeu_si512((void*) (c1 + lanes), c11);
+	_mm512_storeu_si512((void*) c2, c20);
+	_mm512_storeu_si512((void*) (c2 + lanes), c21);
+	_mm512_storeu_si512((void*) c3, c30);
+	_mm512_storeu_si512((void*) (c3 + lanes), c31);
+
+}	// end - minplus_tile_avx512()
+
+#endif
+
+// Tile kernel on the widest SIMD the CPU has
+// Return the number of columns done - the rest are left to the caller
+template <class I>
+inline int minplus_tile_simd(I* C, int n, const I* const* pivot, int col,
+							 const I* limit, int depth, int len) {
+
+	int j = 0;
+
+#ifdef MINPLUS_SIMD
+	int level = minplus_simd_level();
+	if (level == 2) {
+		const int width = 2 * 64 / sizeof(I);
+		for (; j + width <= len; j += width)
+			minplus_tile_avx512(C + j, n, pivot, col + j, limit, depth);
+	}
+	else if (level == 1) {
+		const int width = 2 * 32 / sizeof(I);
+		for (; j + width <= len; j += width)
+			minplus_tile_avx2(C + j, n, pivot, col + j, limit, depth);
+	}
+#endif
+
+	return j;
+
+}	// end - minplus_tile_simd()
+
+// Signed integral weights - route on the width
+template <class T>
+inline int minplus_tile(T* C, int n, const T* const* pivot, int col,
+						const T* limit, int depth, int len, true_type) {
+
+	if (sizeof(T) == sizeof(int32_t))
+		return minplus_tile_simd((int32_t*) C, n, (const int32_t* const*) pivot,
+								 col, (const int32_t*) limit, depth, len);
+	if (sizeof(T) == sizeof(int64_t))
+		return minplus_tile_simd((int64_t*) C, n, (const int64_t* const*) pivot,
+								 col, (const int64_t*) limit, depth, len);
+
+	return 0;
+
+}	// end - minplus_tile(signed)
+
+// Any other weight type - no SIMD tile
+template <class T>
+inline int minplus_tile(T*, int, const T* const*, int, const T*, int, int,
+						false_type) {
+	return 0;
+}
+
+// One min-plus product tile of n x n matrices
+// C[i][j] = min(C[i][j], A[i][k] + B[k][j])
+// for i in [i0, i1), j in [j0, j1), k in [k0, k1)
+// C must not alias A or B
+template <class T>
+inline void minplus_gemm_block(T* C, const T* A, const T* B, int n,
+							   int i0, int i1,
+							   int j0, int j1,
+							   int k0, int k1) {
+
+	// Define infinity
+	const T infinity = numeric_limits<T>::max();
+
+	// Middle vertices per pass, their B rows and A constants
+	const int depth = 64;
+	const T* pivot[depth];
+	T limit[12 * depth];
+
+	// 4 rows at a time in registers
+	int i = i0;
+	for (; i + 4 <= i1; i += 4) {
+
+		const T* a = A + (size_t) i * n;
+		T* rows = C + (size_t) i * n + j0;
+
+		for (int kb = k0; kb < k1; kb += depth) {
+
+			// Keep the middle vertices two or more rows can go through
+			int count = 0;
+			for (int k = kb; k < min(kb + depth, k1); k++) {
+
+				int reachable = 0;
+				int last = 0;
+				for (int r = 0; r < 4; r++)
+					if (a[(size_t) r * n + k] != infinity) {
+						reachable++;
+						last = r;
+					}
+
+				// A single row is cheaper with the row kernel
+				if (reachable < 2) {
+					if (reachable == 1)
+						minplus_row(rows + (size_t) last * n, B + (size_t) k * n + j0,
+									a[(size_t) last * n + k], j1 - j0);
+					continue;
+				}
+
+				pivot[count] = B + (size_t) k * n;
+				for (int r = 0; r < 4; r++)
+					minplus_tile_limits(a[(size_t) r * n + k], limit + 12 * count + r);
+				count++;
+			}
+
+			if (count == 0)
+				continue;
+
+			// SIMD tiles, then the remaining columns
+			int done = minplus_tile(rows, n, pivot, j0, limit, count, j1 - j0,
+									integral_constant<bool, is_integral<T>::value &&
+															is_signed<T>::value>());
+			minplus_tile_scalar(rows + done, n, pivot, j0 + done, limit, count,
+								j1 - j0 - done);
+		}
+	}
+
+	// Remaining rows one at a time - the C row segment stays in L1
+	for (; i < i1; i++) {
+
+		T* row = C + (size_t) i * n + j0;
+		const T* a = A + (size_t) i * n;
+
+		for (int k = k0; k < k1; k++) {
+
+			// Nothing to relax through an unreachable middle vertex
+			T aik = a[k];
+			if (aik == infinity)
+				continue;
+
+			minplus_row(row, B + (size_t) k * n + j0, aik, j1 - j0);
+		}
+	}
+
+}	// end - minplus_gemm_block()
+
+// Min-plus product tile that also tracks the next-hop matrices
+// NC[i][j] = NA[i][k] where C[i][j] got shorter through k
+template <class T, class I>
+inline void minplus_gemm_block(T* C, I* NC, const T* A, const I* NA,
+							   const T* B, int n,
+							   int i0, int i1,
+							   int j0, int j1,
+							   int k0, int k1) {
+
+	// Define infinity
+	const T infinity = numeric_limits<T>::max();
+
+	// Row at a time - the C row segment stays in L1 across the k loop
+	for (int i = i0; i < i1; i++) {
+
+		T* row = C + (size_t) i * n + j0;
+		I* next = NC + (size_t) i * n + j0;
+		size_t a = (size_t) i * n;
+
+		for (int k = k0; k < k1; k++) {
+
+			// Nothing to relax through an unreachable middle vertex
+			if (A[a + k] == infinity)
+				continue;
+
+			minplus_row(row, next, B + (size_t) k * n + j0,
+						A[a + k], NA[a + k], j1 - j0);
+		}
+	}
+
+}	// end - minplus_gemm_block(next)
+
+#endif /* MINPLUS_H_ */
@@ -0,0 +1,139 @@
+/*
+ * SSSPCache.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef SSSPCACHE_H_
+#define SSSPCACHE_H_
+
+#include "SSSPCache_class.h"
+
+
+// Cache with the specified memory budget
+template <class T>
+SSSPCache<T>::SSSPCache(size_t bytes):budget(bytes),
+									  used(0),
+									  version(0),
+									  hits(0),
+									  misses(0),
+									  evictions(0),
+									  invalidations(0) {
+}
+
+// Return the cached tree of a source
+template <class T>
+SSSPTree<T>* SSSPCache<T>::find(int source, unsigned long graph_version) {
+
+	// The graph changed - every tree is stale
+	if (graph_version != version) {
+		if (!trees.empty())
+			invalidations++;
+		clear();
+		version = graph_version;
+	}
+
+	auto entry = index.find(source);
+
+	// Miss
+	if (entry == index.end()) {
+		misses++;
+		return nullptr;
+	}
+
+	// Hit - move to the front
+	hits++;
+	trees.splice(trees.begin(), trees, entry->second);
+
+	return &entry->second->second;
+
+}	// end - find()
+
+// Cache the tree of a source
+template <class T>
+SSSPTree<T>* SSSPCache<T>::insert(int source, SSSPTree<T>& tree) {
+
+	size_t size = tree.bytes();
+
+	// Too large to cache
+	if (size > budget)
+		return nullptr;
+
+	// Replace an existing tree
+	auto entry = index.find(source);
+	if (entry != index.end()) {
+		used -= entry->second->second.bytes();
+		trees.erase(entry->second);
+		index.erase(entry);
+	}
+
+	// Evict least recently used trees to fit
+	while (used + size > budget && !trees.empty()) {
+		used -= trees.back().second.bytes();
+		index.erase(trees.back().first);
+		trees.pop_back();
+		evictions++;
+	}
+
+	// Insert at the front - takes over the tree's arrays
+	trees.push_front(make_pair(source, SSSPTree<T>()));
+	trees.front().second.swap(tree);
+	index[source] = trees.begin();
+	used += size;
+
+	return &trees.front().second;
+
+}	// end - insert()
+
+// Remove every tree
+template <class T>
+void SSSPCache<T>::clear() {
+
+	trees.clear();
+	index.clear();
+	used = 0;
+
+}	// end - clear()
+
+// Return the number of hits
+template <class T>
+unsigned long SSSPCache<T>::Hits() {
+	return hits;
+}
+
+// Return the number of misses
+template <class T>
+unsigned long SSSPCache<T>::Misses() {
+	return misses;
+}
+
+// Return the memory used in bytes
+template <class T>
+size_t SSSPCache<T>::Bytes() {
+	return used;
+}
+
+// Print the cache statistics
+template <class T>
+void SSSPCache<T>::print_stats() {
+
+	// Hit rate
+	unsigned long lookups = hits + misses;
+	double rate = lookups ? (100.0 * hits) / lookups : 0;
+
+	cout << endl;
+
+	cout << "cached trees = " << trees.size() << endl;
+	cout << "bytes = " << used << " / " << budget << endl;
+	cout << "hits = " << hits << endl;
+	cout << "misses = " << misses << endl;
+	cout << "hit rate = " << rate << "%" << endl;
+	cout << "evictions = " << evictions << endl;
+	cout << "invalidations = " << invalidations << endl;
+
+	cout << endl;
+
+}	// end - print_stats()
+
+#endif /* SSSPCACHE_H_ */
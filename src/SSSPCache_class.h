@@ -0,0 +1,75 @@
+/*
+ * SSSPCache_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef SSSPCACHE_CLASS_H_
+#define SSSPCACHE_CLASS_H_
+
+#include <list>
+#include <unordered_map>
+
+using namespace std;
+
+#include "SSSPTree.h"
+
+
+// Least-recently-used cache of shortest-path trees keyed by source
+// Bounded by a memory budget, flushed when the graph version changes
+template <class T>
+class SSSPCache {
+
+private:
+
+	// Trees, most recently used first
+	list< pair<int, SSSPTree<T> > > trees;
+
+	// Source -> position in the list
+	unordered_map<int, typename list< pair<int, SSSPTree<T> > >::iterator> index;
+
+	// Memory budget in bytes
+	size_t budget;
+
+	// Memory used by the cached trees in bytes
+	size_t used;
+
+	// Graph version the trees were computed on
+	unsigned long version;
+
+	// Statistics
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long evictions;
+	unsigned long invalidations;
+
+public:
+
+	// Cache with the specified memory budget in bytes
+	SSSPCache(size_t);
+
+	// Return the cached tree of a source, nullptr on a miss
+	// A different graph version flushes the cache first
+	SSSPTree<T>* find(int, unsigned long);
+
+	// Cache the tree of a source, evicting least recently used trees
+	// Returns the cached tree, nullptr if it doesn't fit the budget
+	SSSPTree<T>* insert(int, SSSPTree<T>&);
+
+	// Remove every tree
+	void clear();
+
+	// Return the statistics
+	unsigned long Hits();
+	unsigned long Misses();
+
+	// Return the memory used in bytes
+	size_t Bytes();
+
+	// Print the cache statistics
+	void print_stats();
+
+};	// end - SSSPCache class
+
+#endif /* SSSPCACHE_CLASS_H_ */
@@ -0,0 +1,123 @@
+/*
+ * SSSPTree.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef SSSPTREE_H_
+#define SSSPTREE_H_
+
+#include "SSSPTree_class.h"
+
+
+// Empty tree
+template <class T>
+SSSPTree<T>::SSSPTree():source(-1) {
+}
+
+// Reset to an unsearched tree
+template <class T>
+void SSSPTree<T>::assign(int from, int size) {
+
+	source = from;
+
+	dist.assign(size, numeric_limits<T>::max());
+	pred.assign(size, -1);
+
+}	// end - assign()
+
+// Return the source vertex
+template <class T>
+int SSSPTree<T>::Source() {
+	return source;
+}
+
+// Return the number of vertices
+template <class T>
+int SSSPTree<T>::Vertices() {
+	return dist.size();
+}
+
+// Return true if the vertex is reachable
+template <class T>
+bool SSSPTree<T>::reachable(int v) {
+
+	// Check for a valid vertex
+	if (v < 0 || v >= (int) dist.size())
+		return false;
+
+	return dist[v] != numeric_limits<T>::max();
+}
+
+// Return the distance to a vertex
+template <class T>
+T SSSPTree<T>::distance(int v) {
+
+	// Check for a valid vertex
+	if (v < 0 || v >= (int) dist.size())
+		return numeric_limits<T>::max();
+
+	return dist[v];
+}
+
+// Return the predecessor of a vertex
+template <class T>
+int SSSPTree<T>::predecessor(int v) {
+
+	// Check for a valid vertex
+	if (v < 0 || v >= (int) pred.size())
+		return -1;
+
+	return pred[v];
+}
+
+// Return the source -> target path node list
+template <class T>
+list<int> SSSPTree<T>::path(int target) {
+
+	// The path node list
+	list<int> nodes;
+
+	// No path to this node
+	if (!reachable(target))
+		return nodes;
+
+	// Walk the predecessors back to the source
+	for (int v = target; v != -1; v = pred[v])
+		nodes.push_front(v);
+
+	return nodes;
+
+}	// end - path()
+
+// Return the distance array
+template <class T>
+T* SSSPTree<T>::distances() {
+	return dist.data();
+}
+
+// Return the predecessor array
+template <class T>
+int* SSSPTree<T>::predecessors() {
+	return pred.data();
+}
+
+// Return the memory used by the tree in bytes
+template <class T>
+size_t SSSPTree<T>::bytes() {
+	return sizeof(*this) + dist.capacity() * sizeof(T)
+						 + pred.capacity() * sizeof(int);
+}
+
+// Exchange the contents with another tree
+template <class T>
+void SSSPTree<T>::swap(SSSPTree<T>& other) {
+
+	std::swap(source, other.source);
+	dist.swap(other.dist);
+	pred.swap(other.pred);
+
+}	// end - swap()
+
+#endif /* SSSPTREE_H_ */
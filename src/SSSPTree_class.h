@@ -0,0 +1,75 @@
+/*
+ * SSSPTree_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef SSSPTREE_CLASS_H_
+#define SSSPTREE_CLASS_H_
+
+#include <vector>
+#include <list>
+#include <limits>
+
+using namespace std;
+
+
+// Single-source shortest-path result
+// Distances and the predecessor tree of one search, queried any number of times
+template <class T>
+class SSSPTree {
+
+private:
+
+	// Source vertex
+	int source;
+
+	// Distance to each vertex, numeric_limits<T>::max() if unreachable
+	vector<T> dist;
+
+	// Predecessor of each vertex on its shortest path, -1 for none
+	vector<int> pred;
+
+public:
+
+	// Empty tree
+	SSSPTree();
+
+	// Reset to an unsearched tree of the specified source and size
+	void assign(int, int);
+
+	// Return the source vertex
+	int Source();
+
+	// Return the number of vertices
+	int Vertices();
+
+	// Return true if the vertex is reachable
+	bool reachable(int);
+
+	// Return the distance to a vertex
+	T distance(int);
+
+	// Return the predecessor of a vertex
+	int predecessor(int);
+
+	// Return the source -> target path node list
+	// Empty if unreachable
+	list<int> path(int);
+
+	// Return the distance array
+	T* distances();
+
+	// Return the predecessor array
+	int* predecessors();
+
+	// Return the memory used by the tree in bytes
+	size_t bytes();
+
+	// Exchange the contents with another tree
+	void swap(SSSPTree<T>&);
+
+};	// end - SSSPTree class
+
+#endif /* SSSPTREE_CLASS_H_ */
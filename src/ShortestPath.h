@@ -18,7 +18,17 @@ template <class T>
 ShortestPath<T>::ShortestPath(string filename): shortest_path_distance(0),
 												graph_size(0),
 												pPath_list(nullptr),
-												P(nullptr) {
+												list_version(0),
+												dense_graph(false),
+												pCache(nullptr),
+												min_potential(0),
+												potential_version(0),
+												apsp_block(64),
+												threads(ThreadPool::hardware_threads()),
+												pPool(nullptr),
+												record_paths(false),
+												apsp_valid(false),
+												unit_weights(false) {
 
 	// Setup a file stream
 	ifstream data_file(filename);
@@ -44,7 +54,7 @@ ShortestPath<T>::ShortestPath(string filename): shortest_path_distance(0),
 		return;
 
 	// Generate and initialize a 2-D graph class
-	SSSPgraph = Graph<int>(graph_size);
+	SSSPgraph = Graph<T>(graph_size);
 
 	// Set all existing edges from the file
 	while ( input != eos ) {
@@ -52,12 +62,17 @@ ShortestPath<T>::ShortestPath(string filename): shortest_path_distance(0),
 		// Read the edge values
 		int tail = *input++;
 		int head = *input++;
-		long dist = *input++;
+		T dist = *input++;
 
 		// Convert to zero-based graph
 		SSSPgraph.set_edge_value(tail-1, head-1, dist);
 	}
 
+	// Generate the adjacency list
+	SSSPlist = AdjacencyList<T>(SSSPgraph);
+	list_version = SSSPgraph.Version();
+	dense_graph = true;
+
 }	// end - ShortestPath(string)
 
 // Constructor for All-Pairs Shortest Path class
@@ -66,7 +81,17 @@ ShortestPath<T>::ShortestPath(string filename, string algorithm):
 													shortest_path_distance(0),
 													graph_size(0),
 													pPath_list(nullptr),
-													P(nullptr) {
+													list_version(0),
+													dense_graph(false),
+													pCache(nullptr),
+													min_potential(0),
+													potential_version(0),
+													apsp_block(64),
+													threads(ThreadPool::hardware_threads()),
+													pPool(nullptr),
+													record_paths(false),
+													apsp_valid(false),
+													unit_weights(false) {
 
 	// Setup a file stream
 	ifstream data_file(filename);
@@ -91,23 +116,23 @@ ShortestPath<T>::ShortestPath(string filename, string algorithm):
 	if (graph_size < 2)
 		return;
 
-	// Generate and initialize a 3-D graph class
+	// "Johnson" only needs the adjacency list
+	if (!algorithm.compare(sJ)) {
+		data_file.close();
+		SSSPlist = AdjacencyList<T>(filename);
+		graph_size = SSSPlist.Vertices();
+		return;
+	}
+
+	// Generate and initialize the All-Pairs distance matrix
 	APSPgraph = Graph<T>(graph_size, graph_size, algorithm);
 
 	// Update the graph size
 	graph_size = APSPgraph.Vertices();
 
 	// Set all i to i node distances to 0
-	for (int k=0; k<3; k++) {
-		for (int i=0; i<graph_size; i++) {
-			APSPgraph.set_APSP_edge_value(i, i, k, (T) 0);
-		}
-	}
-
-	// Set index adjustment
-	int adj = 0;		// Johnson
-	if (!algorithm.compare(sFW))
-		adj++;			// Floyd-Warshall
+	for (int i=0; i<graph_size; i++)
+		APSPgraph.set_APSP_edge_value(i, i, init, (T) 0);
 
 	// Set all existing edges from the file
 	while ( input != eos ) {
@@ -117,11 +142,14 @@ ShortestPath<T>::ShortestPath(string filename, string algorithm):
 		int head = *input++;
 		T dist = *input++;
 
-		// Put into each of the k graphs
-		for (int k=0; k<3; k++)
-			APSPgraph.set_APSP_edge_value(tail-adj, head-adj, k, dist);
+		// Convert to zero-based graph
+		APSPgraph.set_APSP_edge_value(tail-1, head-1, init, dist);
 	}
 
+	// Keep the edges for incremental updates
+	data_file.close();
+	SSSPlist = AdjacencyList<T>(filename);
+
 }	// end - ShortestPath(filename, algorithm)
 
 
@@ -129,6 +157,72 @@ ShortestPath<T>::ShortestPath(string filename, string algorithm):
 template <class T>
 ShortestPath<T>::~ShortestPath(void) {
 	cout << "Deleting ShortestPath class" << endl;
+
+	// Stop the worker threads
+	if (pPool != nullptr)
+		delete pPool;
+
+	// Deallocate the tree cache
+	if (pCache != nullptr)
+		delete pCache;
+}
+
+// Get the forced unit-weight flag
+template <class T>
+bool ShortestPath<T>::getUnitWeights() {
+	return unit_weights;
+}
+
+// Treat every edge as weight 1
+template <class T>
+void ShortestPath<T>::setUnitWeights(bool unit) {
+
+	unit_weights = unit;
+
+	// Cached trees hold the other kind of distance
+	if (pCache != nullptr)
+		pCache->clear();
+
+}	// end - setUnitWeights()
+
+// True if searches run breadth-first
+template <class T>
+bool ShortestPath<T>::useBFS() {
+	return unit_weights || SSSPlist.unit_weight();
+}
+
+// Get the number of worker threads
+template <class T>
+int ShortestPath<T>::getThreads() {
+	return threads;
+}
+
+// Set the number of worker threads, 0 = hardware threads
+template <class T>
+void ShortestPath<T>::setThreads(int count) {
+
+	// Default to the hardware threads
+	if (count < 1)
+		count = ThreadPool::hardware_threads();
+
+	// Restart the pool on the next parallel run
+	if (count != threads && pPool != nullptr) {
+		delete pPool;
+		pPool = nullptr;
+	}
+
+	threads = count;
+}
+
+// Get the worker thread pool
+template <class T>
+ThreadPool& ShortestPath<T>::getPool() {
+
+	// Start the workers if necessary
+	if (pPool == nullptr)
+		pPool = new ThreadPool(threads);
+
+	return *pPool;
 }
 
 // Get the graph size
@@ -137,6 +231,87 @@ int ShortestPath<T>::getGraphSize() {
 	return graph_size;
 }
 
+// True if the All-Pairs distance matrix exists
+template <class T>
+bool ShortestPath<T>::hasAPSPgraph() {
+	return graph_size >= 2 && APSPgraph.Vertices() == graph_size;
+}
+
+// Keep new potentials - the minimum bounds every search that uses them
+template <class T>
+void ShortestPath<T>::setPotentials(const vector<T>& potentials) {
+
+	potential = potentials;
+
+	min_potential = 0;
+	for (auto h : potential)
+		min_potential = min(min_potential, h);
+
+}	// end - setPotentials()
+
+// True if every edge u->v has h(u) + w >= h(v)
+template <class T>
+bool ShortestPath<T>::feasiblePotentials() {
+
+	int n = SSSPlist.Vertices();
+	if (potential.size() != (size_t) n)
+		return false;
+
+	for (int u=0; u<n; u++)
+		for (int e = SSSPlist.out_begin(u); e < SSSPlist.out_end(u); e++)
+			if (potential[u] + SSSPlist.weight(e) < potential[SSSPlist.head(e)])
+				return false;
+
+	return true;
+
+}	// end - feasiblePotentials()
+
+// Potentials for searches of the current edges
+// Checked once per edge change, Bellman-Ford only for negative edges
+template <class T>
+string ShortestPath<T>::checkPotentials() {
+
+	// Pick up any edge changes
+	refreshList();
+
+	// Check again after any edge change
+	if (potential_status.empty() || potential_version != list_version) {
+
+		potential_version = list_version;
+		potential_status = "OK";
+
+		// Potentials from before the change may still be valid
+		if (!feasiblePotentials()) {
+
+			// Check for a negative edge
+			bool negative = false;
+			for (int u=0; u<SSSPlist.Vertices() && !negative; u++)
+				for (int e = SSSPlist.out_begin(u); e < SSSPlist.out_end(u); e++)
+					if (SSSPlist.weight(e) < 0) {
+						negative = true;
+						break;
+					}
+
+			// Non-negative edges search without potentials
+			if (!negative)
+				setPotentials(vector<T>());
+			else {
+				BellmanFord<T> potentials(SSSPlist);
+				potential_status = potentials.getPotentials();
+				if (!potential_status.compare("OK"))
+					setPotentials(potentials.Potentials());
+			}
+		}
+	}
+
+	// Check for a negative-cost cycle
+	if (!potential_status.compare("NULL"))
+		cerr << "Negative-cost cycle" << endl;
+
+	return potential_status;
+
+}	// end - checkPotentials()
+
 // Get a graph entry
 template <class T>
 T ShortestPath<T>::GetGraphEntry(int i, int j, int k) {
@@ -156,6 +331,10 @@ T ShortestPath<T>::GetGraphEntry(int i, int j, int k) {
 	if (k<0 || k>=graph_size)
 		return infinity;
 
+	// Check for a distance matrix
+	if (!hasAPSPgraph())
+		return infinity;
+
 	// Return the graph entry
 	return APSPgraph.get_APSP_edge_value(i, j, k);
 
@@ -168,15 +347,18 @@ T ShortestPath<T>::getShortestPathDistance() {
 }
 
 // Dijkstra shortest-path algorithm
+// Runs in the calling thread's workspace - no per-query allocation
+// reweight searches the graph with this object's Johnson potentials
 template <class T>
-void ShortestPath<T>::getShortestPath(Graph<T> graph,
+void ShortestPath<T>::getShortestPath(Graph<T>& graph,
 									 const int start,
-									 const int end) {
+									 const int end,
+									 bool reweight) {
 
 	const bool DEBUG = false;
 
 	// Define infinity
-	int MAX_DIST = numeric_limits<int>::max();
+	T MAX_DIST = numeric_limits<T>::max();
 
 	// Check for same node
 	if (start == end) {
@@ -187,38 +369,50 @@ void ShortestPath<T>::getShortestPath(Graph<T> graph,
 	// Calculate the graph size
 	int size = graph.Vertices();
 
-	// Define and initialize the local lists
-	vector<bool> visited(size, false);
-	vector<int> node_dist(size, MAX_DIST);
+	// Johnson potentials must match the graph
+	if (reweight && potential.size() != (size_t) size) {
+		cerr << "No Johnson potentials for this graph" << endl;
+		shortest_path_distance = 0;
+		return;
+	}
 
-	// Generate a local path node vector
-	vector<int>* pNode_list = new vector<int>(size, -1);
+	// Start a new query - O(previous query) reset
+	Workspace<T>& ws = Workspace<T>::local();
+	ws.reset(size);
 
-	// Set the start node distance to 0
-	node_dist[start] = 0;
+	// Breadth-first on unit-weight graphs
+	bool unit = !reweight && unitShortestPath(graph, start, end, ws);
 
-	// Loop counter
-	int count = 0;
+	// Weighted graph - start over
+	if (!unit) {
+		ws.reset(size);
 
-	// Loop through the vertices
-	while(count < size) {
+		// Set the start node distance to 0
+		ws.label(start, 0, -1);
+	}
 
-		int minDistance = MAX_DIST;
-		int closestNode = 0;
+	// Loop through the reached vertices
+	while (!unit) {
 
-		// Find the closest adjacent node
-		for(int i = 0; i < size; i++) {
-			if((!visited[i]) && (minDistance >= node_dist[i])) {
-				minDistance = node_dist[i];
+		T minDistance = MAX_DIST;
+		int closestNode = -1;
+
+		// Find the closest unvisited node
+		for (auto i : ws.Touched()) {
+			if (!ws.is_settled(i) && ws.distance(i) <= minDistance) {
+				minDistance = ws.distance(i);
 				closestNode = i;
 			}
 		}
 
+		// Nothing left to reach
+		if (closestNode == -1)
+			break;
+
 		// Indicate this node has been visited
-		visited[closestNode] = true;
+		ws.settle(closestNode);
 
 		if (DEBUG) {
-			cout << "count = " << count << endl;
 			cout << "closestNode = " << closestNode << endl;
 			cout << "minDistance = " << minDistance << endl;
 		}
@@ -226,213 +420,951 @@ void ShortestPath<T>::getShortestPath(Graph<T> graph,
 		// Loop through the nodes
 		for(int i = 0; i < size; i++) {
 
-			// Get the distance to this node from the start node
-			int cur_distance;
+			// Get the edge from the closest node
+			T edge = graph.get_edge_value(closestNode, i);
 
-			// Check for MAX_DIST
-			if (node_dist[closestNode] == MAX_DIST)
-				cur_distance = MAX_DIST;
-			else
-				cur_distance = node_dist[closestNode] +
-										graph.get_edge_value(closestNode, i);
-
-			// Adjust current distance
-			if (P != nullptr)
-				if (cur_distance != MAX_DIST)
-					cur_distance += P[closestNode] - P[i];
+			// Skip missing edges and visited nodes
+			if (edge == 0 || edge == MAX_DIST || ws.is_settled(i))
+				continue;
 
-			// If the node has not been visited and the distance is not 0
-			if (!visited[i] && (graph.get_edge_value(closestNode, i) != 0) ) {
-
-				// If this node is closer
-				if (node_dist[i] > cur_distance) {
+			// Get the distance to this node from the start node
+			T cur_distance = minDistance + edge;
 
-					// Put the current distance into the list
-					node_dist[i] = cur_distance;
+			// Adjust current distance
+			if (reweight)
+				cur_distance += potential[closestNode] - potential[i];
 
-					// Put the current node into the path list
-					pNode_list->at(i) = closestNode;
-				}
-			}
+			// If this node is closer
+			if (cur_distance < ws.distance(i))
+				// Put the distance and path node into the workspace
+				ws.label(i, cur_distance, closestNode);
 		}
-
-		// Move to the next node
-		count++;
 	}
 
 	// Set the shortest path distance
-	shortest_path_distance = node_dist[end];
+	shortest_path_distance = ws.distance(end);
 	if (shortest_path_distance == MAX_DIST)
 		shortest_path_distance = 0;
-	else {
-		shortest_path_distance -= node_dist[start];
+	else if (reweight)
 		// Adjust for "Johnson" algorithm
-		shortest_path_distance += -P[start] + P[end];
-	}
+		shortest_path_distance += -potential[start] + potential[end];
 
- 	// Don't create a shortest path for "Johnson"
- 	if (P == nullptr) {
- 		// Create the shortest path list
- 		createPath_list();
+	// Create the shortest path list - reweighting keeps the same paths
+	createPath_list();
 
- 		// Generate the path node list - for Dijkstra
- 		genPathNodeList(*pNode_list, end);
- 	}
+	// Walk the path nodes back from the end
+	if (ws.reached(end))
+		for (int node = end; node != -1; node = ws.predecessor(node))
+			pPath_list->push_front(node);
 
 	// Test output
 	if (DEBUG) {
 		cout << "The distances to the other nodes are:" << endl;
-		for(int i = start; i <= end; i++) {
-			cout << i << " : " << node_dist[i] << endl;
-		}
-		cout << endl;
-		cout << "The path node list is:" << endl;
-		for (auto i : *pNode_list) {
-			if (i == 0)
-				cout << i;
-			else
-				cout << " -> " << i;
-		}
+		for (auto i : ws.Touched())
+			cout << i << " : " << ws.distance(i) << endl;
 		cout << endl;
 	}
 
 }	// end - getShortestPath()
 
-// Floyd-Warshall shortest path algorithm
+// Breadth-first point-to-point search of a dense graph
+// The touched list is the FIFO queue - labels are hop counts
 template <class T>
-string ShortestPath<T>::getAPSPShortestPath(string algorithm) {
+bool ShortestPath<T>::unitShortestPath(Graph<T>& graph,
+									   int start,
+									   int end,
+									   Workspace<T>& ws) {
 
 	// Define infinity
-	long infinity = numeric_limits<long>::max();
+	T MAX_DIST = numeric_limits<T>::max();
+
+	// Calculate the graph size
+	int size = graph.Vertices();
+
+	// Set the start node distance to 0
+	ws.label(start, 0, -1);
+
+	// The touched list grows as vertices are labeled
+	for (size_t q = 0; q < ws.Touched().size(); q++) {
+
+		int node = ws.Touched()[q];
+		T hops = ws.distance(node);
+
+		// Loop through the nodes
+		for (int i = 0; i < size; i++) {
+
+			// Get the edge from this node
+			T edge = graph.get_edge_value(node, i);
+
+			// Skip missing edges
+			if (edge == 0 || edge == MAX_DIST)
+				continue;
+
+			// Not a unit-weight graph
+			if (edge != 1 && !unit_weights)
+				return false;
+
+			// First label is the shortest
+			if (ws.reached(i))
+				continue;
+			ws.label(i, hops + 1, node);
+
+			// Done at the end node
+			if (i == end)
+				return true;
+		}
+	}
+
+	return true;
 
-	// Define the current distance
-	long distance;
+}	// end - unitShortestPath()
 
-	// Upper limit for i
-	int i_size = graph_size;
+// Rebuild the adjacency list after edge changes
+template <class T>
+void ShortestPath<T>::refreshList() {
+
+	if (dense_graph && list_version != SSSPgraph.Version()) {
+		SSSPlist = AdjacencyList<T>(SSSPgraph);
+		list_version = SSSPgraph.Version();
+	}
+
+}	// end - refreshList()
+
+// Return the tree of a source, from the cache if enabled
+// tree is the storage used when the result isn't cached
+template <class T>
+SSSPTree<T>* ShortestPath<T>::getSourceTree(int source, SSSPTree<T>& tree) {
+
+	// Pick up any edge changes
+	refreshList();
+
+	// Check the cache
+	if (pCache != nullptr) {
+		SSSPTree<T>* cached = pCache->find(source, list_version);
+		if (cached != nullptr)
+			return cached;
+	}
+
+	// One search fills the whole tree
+	if (useBFS()) {
+		BFS<T> search(SSSPlist);
+		search.run(source, tree);
+	}
+	else {
+		// Reweight by the Johnson potentials for negative edges
+		if (!checkPotentials().compare("NULL"))
+			return nullptr;
+
+		Dijkstra<T> search(SSSPlist,
+						   potential.empty() ? nullptr : potential.data(),
+						   min_potential);
+		search.run(source, tree);
+	}
+
+	// Keep it if it fits
+	if (pCache != nullptr) {
+		SSSPTree<T>* cached = pCache->insert(source, tree);
+		if (cached != nullptr)
+			return cached;
+	}
+
+	return &tree;
+
+}	// end - getSourceTree()
+
+// Single-Source Shortest Path tree
+template <class T>
+SSSPTree<T> ShortestPath<T>::getSingleSource(const int source) {
+
+	// The result tree
+	SSSPTree<T> tree;
+
+	// Check for a valid source
+	if (source < 0 || source >= SSSPlist.Vertices())
+		return tree;
+
+	// Copy out a cached tree
+	SSSPTree<T>* result = getSourceTree(source, tree);
+	if (result != nullptr && result != &tree)
+		return *result;
+
+	return tree;
+
+}	// end - getSingleSource()
+
+// Source -> target distance
+template <class T>
+T ShortestPath<T>::getDistance(const int source, const int target) {
+
+	// Check for a valid source
+	if (source < 0 || source >= SSSPlist.Vertices())
+		return numeric_limits<T>::max();
 
-	// Set upper limit on i
-	// Only the first node for "Johnson" algorithm
-	if (algorithm.compare(sJ)==0)
-		i_size = 1;
+	SSSPTree<T> tree;
+	SSSPTree<T>* result = getSourceTree(source, tree);
+	if (result == nullptr)
+		return numeric_limits<T>::max();
 
-	// Loop through all of the subnode sets
-	for (int k=1; k<graph_size; k++) {
-		// Set an early exit flag
-		bool early_exit = true;
+	return result->distance(target);
 
-		// Loop all of the specified nodes
-		for (int i=0; i<i_size; i++) {
-			// Loop through all of the nodes
-			for (int j=0; j<graph_size; j++) {
+}	// end - getDistance()
 
-				// Local values
-				long dist1 = APSPgraph.get_APSP_edge_value(i, k, prev);
-				long dist2 = APSPgraph.get_APSP_edge_value(k, j, prev);
+// Source -> target path node list
+template <class T>
+list<int> ShortestPath<T>::getPath(const int source, const int target) {
+
+	// Check for a valid source
+	if (source < 0 || source >= SSSPlist.Vertices())
+		return list<int>();
+
+	SSSPTree<T> tree;
+	SSSPTree<T>* result = getSourceTree(source, tree);
+	if (result == nullptr)
+		return list<int>();
+
+	return result->path(target);
+
+}	// end - getPath()
+
+// Every vertex within a distance of source
+template <class T>
+vector< pair<int, T> > ShortestPath<T>::within_radius(const int source,
+													  T radius) {
 
-				// Get current value
-				if ((dist1 == infinity) ||
-					(dist2 == infinity))
-					distance = infinity;
-				else
-					distance = dist1 + dist2;
+	// Potentials for negative edges
+	if (!checkPotentials().compare("NULL"))
+		return vector< pair<int, T> >();
 
-				// Get the inherited value
-				long dist3 = APSPgraph.get_APSP_edge_value(i, j, prev);
+	Dijkstra<T> search(SSSPlist,
+					   potential.empty() ? nullptr : potential.data(),
+					   min_potential);
 
-				// Compare the values
-				if (dist3 < distance) {
+	return search.within_radius(source, radius);
 
-					// Store the inherited distance
-					APSPgraph.set_APSP_edge_value(i, j, curr, dist3);
-				} else {
+}	// end - within_radius()
 
-					// Store the new value
-					APSPgraph.set_APSP_edge_value(i, j, curr, distance);
+// The k nearest vertices with predicate(vertex)
+template <class T>
+vector< pair<int, T> > ShortestPath<T>::k_nearest(const int source,
+												  int k,
+												  function<bool(int)> predicate) {
+
+	// Potentials for negative edges
+	if (!checkPotentials().compare("NULL"))
+		return vector< pair<int, T> >();
+
+	Dijkstra<T> search(SSSPlist,
+					   potential.empty() ? nullptr : potential.data(),
+					   min_potential);
+
+	return search.k_nearest(source, k, predicate);
+
+}	// end - k_nearest()
+
+// Many-to-many sources x targets distance table
+template <class T>
+DistanceTable<T> ShortestPath<T>::distance_table(const vector<int>& sources,
+												 const vector<int>& targets) {
+
+	// Pick up any edge changes
+	refreshList();
+
+	// Graph size
+	int size = SSSPlist.Vertices();
+
+	// The output table
+	int rows = sources.size();
+	int cols = targets.size();
+	DistanceTable<T> table(rows, cols);
+
+	// Check for valid vertices
+	for (auto v : sources)
+		if (v < 0 || v >= size)
+			return table;
+	for (auto v : targets)
+		if (v < 0 || v >= size)
+			return table;
+
+	// Target columns of each vertex - chained for repeated targets
+	vector<int> column(size, -1);
+	vector<int> next_column(cols, -1);
+	for (int j = cols - 1; j >= 0; j--) {
+		next_column[j] = column[targets[j]];
+		column[targets[j]] = j;
+	}
+
+	// Next batch to run
+	atomic<int> next_batch(0);
+
+	// Unit-weight graph - 64 sources per bit-parallel BFS
+	if (useBFS()) {
+
+		int batches = (rows + 63) / 64;
+
+		auto run_batches = [&](int) {
+
+			BFS<T> search(SSSPlist);
+
+			for (int b = next_batch++; b < batches; b = next_batch++) {
+
+				int first = b * 64;
+				int count = min(64, rows - first);
+
+				// Fill the columns of each newly reached target
+				search.multi_source(&sources[first], count,
+									[&](int v, uint64_t bits, int hops) {
+					for (int j = column[v]; j != -1; j = next_column[j]) {
+						for (int s = 0; s < count; s++)
+							if (bits & ((uint64_t) 1 << s))
+								table.at(first + s, j) = hops;
+					}
+				});
+			}
+		};
+
+		// Run the batches
+		if (threads == 1)
+			run_batches(0);
+		else
+			getPool().run(run_batches);
+
+		return table;
+	}
+
+	// Potentials for negative edges
+	if (!checkPotentials().compare("NULL"))
+		return table;
+
+	// Number of distinct target vertices
+	int distinct = 0;
+	for (int v = 0; v < size; v++)
+		if (column[v] != -1)
+			distinct++;
+
+	// Weighted graph - one Dijkstra per source, targets read from the workspace
+	// Each search stops once every target is settled
+	auto run_sources = [&](int) {
+
+		Dijkstra<T> search(SSSPlist,
+						   potential.empty() ? nullptr : potential.data(),
+						   min_potential);
+
+		for (int i = next_batch++; i < rows; i = next_batch++) {
+
+			int settled = 0;
+			search.run_until(sources[i], [&](int v, T) {
+				return column[v] == -1 || ++settled < distinct;
+			});
+
+			T* row = table.row(i);
+			for (int j = 0; j < cols; j++)
+				row[j] = search.distance(targets[j]);
+		}
+	};
+
+	// Run the sources
+	if (threads == 1)
+		run_sources(0);
+	else
+		getPool().run(run_sources);
+
+	return table;
+
+}	// end - distance_table()
+
+// Cache shortest-path trees within the memory budget
+template <class T>
+void ShortestPath<T>::enableCache(size_t bytes) {
+
+	// Drop the current cache
+	if (pCache != nullptr) {
+		delete pCache;
+		pCache = nullptr;
+	}
+
+	// 0 disables caching
+	if (bytes > 0)
+		pCache = new SSSPCache<T>(bytes);
+
+}	// end - enableCache()
+
+// Print the cache statistics
+template <class T>
+void ShortestPath<T>::print_CacheStats() {
+
+	// Check for a cache
+	if (pCache == nullptr) {
+		cout << "No shortest-path tree cache" << endl;
+		return;
+	}
+
+	cout << "Shortest-path tree cache:" << endl;
+	pCache->print_stats();
+
+}	// end - print_CacheStats()
+
+// Set the x->y edge value of a Dijkstra graph
+template <class T>
+void ShortestPath<T>::set_edge_value(int x, int y, T value) {
+
+	// Only the Dijkstra file constructor keeps the graph
+	if (!dense_graph)
+		return;
+
+	// Bumps the graph version - the list and cache refresh lazily
+	SSSPgraph.set_edge_value(x, y, value);
+
+}	// end - set_edge_value()
+
+// Remove the x->y edge of a Dijkstra graph
+template <class T>
+void ShortestPath<T>::remove_edge(int x, int y) {
+
+	// Only the Dijkstra file constructor keeps the graph
+	if (!dense_graph)
+		return;
+
+	// Bumps the graph version - the list and cache refresh lazily
+	SSSPgraph.remove(x, y);
+
+}	// end - remove_edge()
+
+// All-Pairs shortest path algorithm
+// Floyd-Warshall unless algorithm is "Min-Plus"
+template <class T>
+string ShortestPath<T>::getAPSPShortestPath(string algorithm) {
+
+	// Only the Floyd-Warshall file constructor builds the matrix
+	if (!hasAPSPgraph()) {
+		cerr << "No APSP distance matrix" << endl;
+		return "NULL";
+	}
+
+	// Run result
+	string result;
+
+	// Unit-weight graph - bit-parallel BFS hop counts into the matrix
+	if (!record_paths && useBFS()) {
+		hops.clear();
+		T* D = APSPgraph.APSP_data();
+		result = bfs_all_pairs([&](int source, const T* row) {
+			copy(row, row + graph_size, D + (size_t) source * graph_size);
+		});
+		apsp_valid = !result.compare("OK");
+		return result;
+	}
+
+	// Distances only - any recorded hops would go stale
+	if (!record_paths) {
+		hops.clear();
+		if (!algorithm.compare(sMP))
+			result = min_plus<uint8_t>(nullptr);
+		else
+			result = floyd_warshall<uint8_t>(nullptr);
+		apsp_valid = !result.compare("OK");
+		return result;
+	}
+
+	// Start from the edges unless a previous run already recorded the hops
+	if (hops.Vertices() != graph_size) {
+
+		T* D = APSPgraph.APSP_data();
+		hops.assign(graph_size);
+
+		for (int i=0; i<graph_size; i++)
+			for (int j=0; j<graph_size; j++)
+				if (i == j || D[(size_t) i * graph_size + j] != numeric_limits<T>::max())
+					hops.set(i, j, j);
+	}
+
+	// Run with the narrowest hop index type
+	switch (hops.Width()) {
+	case 1:
+		if (!algorithm.compare(sMP))
+			result = min_plus(hops.data<uint8_t>());
+		else
+			result = floyd_warshall(hops.data<uint8_t>());
+		break;
+	case 2:
+		if (!algorithm.compare(sMP))
+			result = min_plus(hops.data<uint16_t>());
+		else
+			result = floyd_warshall(hops.data<uint16_t>());
+		break;
+	default:
+		if (!algorithm.compare(sMP))
+			result = min_plus(hops.data<uint32_t>());
+		else
+			result = floyd_warshall(hops.data<uint32_t>());
+	}
 
-					// Check for negative-cost cycle
-					if (i == j && distance < 0)
-						return "NULL";
+	// Edge updates maintain a valid matrix from here on
+	apsp_valid = !result.compare("OK");
+	return result;
 
-					// Clear the early exit flag
-					early_exit = false;
+}	// end getAPSPShortestPath()
+
+// Floyd-Warshall shortest path algorithm
+// Blocked, in place over the contiguous distance matrix
+// Tracks the next-hop matrix unless next is nullptr
+template <class T>
+template <class I>
+string ShortestPath<T>::floyd_warshall(I* next) {
+
+	// Distance matrix
+	T* D = APSPgraph.APSP_data();
+	int n = graph_size;
+
+	// Tile size and count
+	int B = apsp_block;
+	int tiles = (n + B - 1) / B;
+
+	// Don't start more threads than there are remaining tiles
+	int workers = min(threads, max(1, (tiles - 1) * (tiles - 1)));
+
+	// Negative-cost cycle flag
+	bool negative = false;
+
+	// Per-phase barrier
+	Barrier barrier(workers);
+
+	// One tile update
+	auto tile = [&](int i0, int i1, int j0, int j1, int k0, int k1) {
+		if (next != nullptr)
+			minplus_fw_block(D, next, n, i0, i1, j0, j1, k0, k1);
+		else
+			minplus_fw_block(D, n, i0, i1, j0, j1, k0, k1);
+	};
+
+	// One thread's share of every round
+	auto rounds = [&](int id) {
+
+		// Loop through the diagonal tiles
+		for (int kb=0; kb<n; kb+=B) {
+
+			int ke = min(kb + B, n);
+
+			// Phase 1 - the diagonal tile
+			if (id == 0)
+				tile(kb, ke, kb, ke, kb, ke);
+			barrier.wait();
+
+			// Phase 2 - the pivot row and column tiles
+			int t = 0;
+			for (int b=0; b<n; b+=B) {
+				if (b == kb)
+					continue;
+				if (t++ % workers != id)
+					continue;
+				int be = min(b + B, n);
+				tile(kb, ke, b, be, kb, ke);
+				tile(b, be, kb, ke, kb, ke);
+			}
+			barrier.wait();
+
+			// Phase 3 - the remaining tiles
+			t = 0;
+			for (int ib=0; ib<n; ib+=B) {
+				if (ib == kb)
+					continue;
+				int ie = min(ib + B, n);
+				for (int jb=0; jb<n; jb+=B) {
+					if (jb == kb)
+						continue;
+					if (t++ % workers != id)
+						continue;
+					tile(ib, ie, jb, min(jb + B, n), kb, ke);
 				}
-			}	// for i
-		}	// for j
-
-		// Copy current k to previous k
-		// and initialize current k from initial k
-		for(int i=0; i<graph_size; i++)
-			for (int j=0; j<graph_size; j++) {
-				// Current k to previous k
-				long distance = APSPgraph.get_APSP_edge_value(i, j, curr);
-				APSPgraph.set_APSP_edge_value(i, j, prev, distance);
-				// Initial k to current k
-				distance = APSPgraph.get_APSP_edge_value(i, j, init);
-				APSPgraph.set_APSP_edge_value(i, j, curr, distance);
+			}
+			barrier.wait();
+
+			// Check for negative-cost cycle - every thread reads the diagonal
+			bool cycle = false;
+			for (int i=0; i<n && !cycle; i++)
+				cycle = D[(size_t) i * n + i] < 0;
+			barrier.wait();
+
+			if (cycle) {
+				if (id == 0)
+					negative = true;
+				return;
 			}
 
-		// Check for early exit
-		if (early_exit)
-			return "OK";
+		}	// for kb
+	};
 
-	}	// for k
+	// Run the rounds
+	if (workers == 1)
+		rounds(0);
+	else
+		getPool().run([&](int id) {
+			if (id < workers)
+				rounds(id);
+		});
+
+	// Check for negative-cost cycle
+	if (negative)
+		return "NULL";
 
 	// Return result
 	return "OK";
 
-}	// end getAPSPShortestPath()
+}	// end floyd_warshall()
 
-// Johnson APSP algorithm
+// Set the x->y edge value of an APSP graph
 template <class T>
-string ShortestPath<T>::getJShortestPath(string filename) {
+string ShortestPath<T>::set_APSP_edge_value(int x, int y, T value) {
 
-	// Set the adjustment list size
-	int P_size = graph_size - 1;
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
 
-	// Create the node adjustment list
-	P = new int[P_size]();
+	// Only the Floyd-Warshall file constructor keeps the matrix
+	if (!hasAPSPgraph()) {
+		cerr << "No APSP distance matrix" << endl;
+		return "NULL";
+	}
 
-	// Create node 0 edges to all other vertices
-	for (int i=0; i<graph_size; i++) {
-		// Set on all k planes
-		APSPgraph.set_APSP_edge_value(0, i, 0, 0);
-		APSPgraph.set_APSP_edge_value(0, i, 1, 0);
-		APSPgraph.set_APSP_edge_value(0, i, 2, 0);
+	// Check for valid vertices
+	if (x < 0 || x >= graph_size || y < 0 || y >= graph_size) {
+		cerr << "Invalid graph node: " << x << ":" << y << endl;
+		return "NULL";
 	}
 
-	// Run Floyd-Warshall to get reweighting values
-	string result = getAPSPShortestPath(sJ);
+	// Distance matrix
+	T* D = APSPgraph.APSP_data();
+	int n = graph_size;
+
+	// Current edge weight
+	int edge = SSSPlist.find(x, y);
+	T old_value = (edge < 0) ? infinity : SSSPlist.weight(edge);
+
+	// Nothing to do
+	if (value == old_value)
+		return "OK";
+
+	// Not computed yet - the matrix still holds the edges
+	if (!apsp_valid) {
+		SSSPlist.set_edge(x, y, value);
+		list_version++;
+		if (x != y)
+			D[(size_t) x * n + y] = value;
+		return "OK";
+	}
 
-	// Check the results for a negative cycle
-	if (!result.compare("NULL"))
+	// Insertion or decrease - relax every pair through the edge, O(V^2)
+	if (value < old_value) {
+
+		// Reject a negative-cost cycle through the edge
+		T back = D[(size_t) y * n + x];
+		if (back != infinity && value + back < 0) {
+			cerr << "Negative-cost cycle: " << x << ":" << y << endl;
+			return "NULL";
+		}
+
+		SSSPlist.set_edge(x, y, value);
+		list_version++;
+
+		// Self loops can't shorten anything else
+		if (x == y)
+			return "OK";
+
+		if (record_paths && hops.Vertices() == n) {
+			switch (hops.Width()) {
+			case 1:
+				relax_edge(x, y, value, hops.data<uint8_t>());
+				break;
+			case 2:
+				relax_edge(x, y, value, hops.data<uint16_t>());
+				break;
+			default:
+				relax_edge(x, y, value, hops.data<uint32_t>());
+			}
+		}
+		else
+			relax_edge<uint8_t>(x, y, value, nullptr);
+
+		return "OK";
+	}
+
+	// Increase or removal - only sources with a shortest path over the edge
+	vector<int> affected;
+	if (x != y)
+		for (int i=0; i<n; i++) {
+			T dix = D[(size_t) i * n + x];
+			if (dix != infinity && dix + old_value == D[(size_t) i * n + y])
+				affected.push_back(i);
+		}
+
+	SSSPlist.set_edge(x, y, value);
+	list_version++;
+
+	// Recompute the affected rows
+	return recompute_rows(affected);
+
+}	// end - set_APSP_edge_value()
+
+// Remove the x->y edge of an APSP graph
+template <class T>
+string ShortestPath<T>::remove_APSP_edge(int x, int y) {
+	return set_APSP_edge_value(x, y, numeric_limits<T>::max());
+}
+
+// Relax every pair through a shortened x->y edge
+// D[i][j] = min(D[i][j], D[i][x] + value + D[y][j])
+// Row y and column x can't change without a negative cycle
+template <class T>
+template <class I>
+void ShortestPath<T>::relax_edge(int x, int y, T value, I* next) {
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	// Distance matrix
+	T* D = APSPgraph.APSP_data();
+	int n = graph_size;
+
+	// Destination row
+	const T* row_y = D + (size_t) y * n;
+
+	// Next row to relax
+	atomic<int> next_row(0);
+
+	// Each row is independent
+	auto rows = [&](int) {
+
+		for (int i = next_row++; i < n; i = next_row++) {
+
+			// Row y is the shared source - unchanged, and another
+			// thread may be reading it
+			if (i == y)
+				continue;
+
+			// Nothing reaches the edge
+			T dix = D[(size_t) i * n + x];
+			if (dix == infinity)
+				continue;
+
+			T* row = D + (size_t) i * n;
+			if (next != nullptr) {
+				I hop = (i == x) ? (I) y : next[(size_t) i * n + x];
+				minplus_row(row, next + (size_t) i * n, row_y, dix + value, hop, n);
+			}
+			else
+				minplus_row(row, row_y, dix + value, n);
+		}
+	};
+
+	// Run the rows
+	if (threads == 1)
+		rows(0);
+	else
+		getPool().run(rows);
+
+}	// end - relax_edge()
+
+// Recompute whole rows of the distance matrix by Dijkstra
+template <class T>
+string ShortestPath<T>::recompute_rows(const vector<int>& sources) {
+
+	// Check for work
+	if (sources.empty())
+		return "OK";
+
+	// Potentials from before an increase stay valid - decreases may break them
+	if (!feasiblePotentials()) {
+		BellmanFord<T> potentials(SSSPlist);
+		if (!potentials.getPotentials().compare("NULL"))
+			return "NULL";
+		setPotentials(potentials.Potentials());
+	}
+
+	// Distance matrix
+	T* D = APSPgraph.APSP_data();
+	int n = graph_size;
+
+	// Keep the recorded hops up to date
+	bool update_hops = record_paths && hops.Vertices() == n;
+
+	// Next source to run
+	atomic<int> next_source(0);
+
+	// One-to-all Dijkstra straight into each row
+	auto rows = [&](int) {
+
+		Dijkstra<T> search(SSSPlist, potential.data(), min_potential);
+
+		for (int s = next_source++; s < (int) sources.size(); s = next_source++) {
+			search.run(sources[s], D + (size_t) sources[s] * n);
+			if (update_hops)
+				search.next_hops(hops);
+		}
+	};
+
+	// Run the sources
+	if (threads == 1)
+		rows(0);
+	else
+		getPool().run(rows);
+
+	return "OK";
+
+}	// end - recompute_rows()
+
+// Min-plus APSP algorithm
+template <class T>
+string ShortestPath<T>::getMinPlusShortestPath() {
+	return getAPSPShortestPath(sMP);
+}
+
+// Min-plus APSP algorithm
+// D = D (x) D until no entry changes - ceil(log2(V)) products at most
+// Paths of V edges cover every simple cycle for the diagonal check
+// Tracks the next-hop matrix unless next is nullptr
+template <class T>
+template <class I>
+string ShortestPath<T>::min_plus(I* next) {
+
+	// Distance matrix
+	T* D = APSPgraph.APSP_data();
+	int n = graph_size;
+	size_t cells = (size_t) n * n;
+
+	// Check for a valid size
+	if (n < 2)
+		return "OK";
+
+	// Product buffer - swapped with the source after each squaring
+	vector<T> buffer(cells);
+	T* src = D;
+	T* dst = buffer.data();
+
+	// Next-hop product buffer
+	vector<I> next_buffer(next != nullptr ? cells : 0);
+	I* next_src = next;
+	I* next_dst = next_buffer.data();
+
+	// Tile size and count
+	int B = apsp_block;
+	int tiles = (n + B - 1) / B;
+
+	// Don't start more threads than there are tiles
+	int workers = min(threads, tiles * tiles);
+
+	// Negative-cost cycle flag
+	bool negative = false;
+
+	// Longest path length (in edges) covered so far
+	for (long covered = 1; covered < n; covered *= 2) {
+
+		// Set if any entry got shorter
+		atomic<bool> changed(false);
+
+		// One thread's output tiles of the product
+		auto product = [&](int id) {
+
+			int t = 0;
+			for (int ib=0; ib<n; ib+=B) {
+				int ie = min(ib + B, n);
+				for (int jb=0; jb<n; jb+=B) {
+					if (t++ % workers != id)
+						continue;
+					int je = min(jb + B, n);
+
+					// Start from the current distances
+					for (int i=ib; i<ie; i++) {
+						size_t row = (size_t) i * n;
+						copy(src + row + jb, src + row + je, dst + row + jb);
+						if (next != nullptr)
+							copy(next_src + row + jb, next_src + row + je,
+								 next_dst + row + jb);
+					}
+
+					// Accumulate the tile over every middle block
+					for (int kb=0; kb<n; kb+=B) {
+						int ke = min(kb + B, n);
+						if (next != nullptr)
+							minplus_gemm_block(dst, next_dst, src, next_src, src, n,
+											   ib, ie, jb, je, kb, ke);
+						else
+							minplus_gemm_block(dst, src, src, n,
+											   ib, ie, jb, je, kb, ke);
+					}
+
+					// Check for any change in the tile
+					for (int i=ib; i<ie && !changed; i++)
+						if (!equal(src + (size_t) i * n + jb,
+								   src + (size_t) i * n + je,
+								   dst + (size_t) i * n + jb))
+							changed = true;
+				}
+			}
+		};
+
+		// Run the product
+		if (workers == 1)
+			product(0);
+		else
+			getPool().run([&](int id) {
+				if (id < workers)
+					product(id);
+			});
+
+		swap(src, dst);
+		swap(next_src, next_dst);
+
+		// Check for negative-cost cycle
+		for (int i=0; i<n && !negative; i++)
+			negative = src[(size_t) i * n + i] < 0;
+		if (negative || !changed)
+			break;
+	}
+
+	// Move the result back into the distance matrix
+	if (src != D) {
+		copy(src, src + cells, D);
+		if (next != nullptr)
+			copy(next_src, next_src + cells, next);
+	}
+
+	// Check for negative-cost cycle
+	if (negative)
 		return "NULL";
 
-	// Populate the node adjustment list
-	for (int i=1; i<P_size; i++)
-		P[i-1] = APSPgraph.get_APSP_edge_value(0, i, 1);
+	// Return result
+	return "OK";
 
-	// Create a 2-D graph class
-	SSSPgraph = Graph<int>(filename);
+}	// end - min_plus()
 
-	// Update the graph size
-	graph_size = SSSPgraph.Vertices();
+// Johnson APSP algorithm
+// The graph was loaded by the constructor - filename is unused
+template <class T>
+string ShortestPath<T>::getJShortestPath(string filename) {
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
 
 	// Initialize shortest path
-	int shortest_path = numeric_limits<int>::max();
+	T shortest_path = infinity;
+	mutex shortest_lock;
 
 	// Calculate all shortest paths
-	for (int i=0; i<graph_size; i++) {
-		for (int j=0; j<graph_size; j++) {
+	string result = getJAllPairs([&](int source, const T* row) {
 
-			// Call Dijkstra
-			getShortestPath(SSSPgraph, i, j);
+		// Minimum of this row
+		T row_min = infinity;
+		for (int j=0; j<graph_size; j++)
+			if (row[j] < row_min)
+				row_min = row[j];
 
-			// Check for minimum shortest path
-			if (shortest_path_distance < shortest_path)
-				shortest_path = shortest_path_distance;
-		}
-	}
+		// Check for minimum shortest path
+		lock_guard<mutex> guard(shortest_lock);
+		if (row_min < shortest_path)
+			shortest_path = row_min;
+	});
+
+	// Check the results for a negative cycle
+	if (!result.compare("NULL"))
+		return "NULL";
 
 	// Set the shortest path distance
 	shortest_path_distance = shortest_path;
@@ -442,6 +1374,146 @@ string ShortestPath<T>::getJShortestPath(string filename) {
 
 }	// end - getJShortestPath()
 
+// Johnson all-pairs rows streamed to a consumer
+// consumer(source, row) is called from the worker threads
+template <class T>
+string ShortestPath<T>::getJAllPairs(function<void(int, const T*)> consumer) {
+
+	// Unit-weight graph - no potentials needed
+	if (!record_paths && useBFS())
+		return bfs_all_pairs(consumer);
+
+	// Compute the potentials from a virtual source - O(V+E) memory
+	BellmanFord<T> potentials(SSSPlist);
+	string result = potentials.getPotentials();
+
+	// Check the results for a negative cycle
+	if (!result.compare("NULL"))
+		return "NULL";
+
+	// Keep the potentials
+	setPotentials(potentials.Potentials());
+
+	// Each source fills its own next-hop row
+	if (record_paths)
+		hops.assign(graph_size);
+	else
+		hops.clear();
+
+	// Next source to run
+	atomic<int> next_source(0);
+
+	// One-to-all Dijkstra per source - per-thread scratch buffers
+	auto sources = [&](int) {
+
+		Dijkstra<T> search(SSSPlist, potential.data(), min_potential);
+		vector<T> row(graph_size);
+
+		for (int s = next_source++; s < graph_size; s = next_source++) {
+			search.run(s, row.data());
+			if (record_paths)
+				search.next_hops(hops);
+			consumer(s, row.data());
+		}
+	};
+
+	// Run the sources
+	if (threads == 1)
+		sources(0);
+	else
+		getPool().run(sources);
+
+	// Return OK
+	return "OK";
+
+}	// end - getJAllPairs(consumer)
+
+// Bit-parallel BFS all-pairs hop counts streamed to a consumer
+// consumer(source, row) is called from the worker threads
+template <class T>
+string ShortestPath<T>::bfs_all_pairs(function<void(int, const T*)> consumer) {
+
+	// Graph size
+	int n = SSSPlist.Vertices();
+	int batches = (n + 63) / 64;
+
+	// Next batch to run
+	atomic<int> next_batch(0);
+
+	// 64 sources per search - per-thread scratch buffers
+	auto run_batches = [&](int) {
+
+		BFS<T> search(SSSPlist);
+		vector<T> rows((size_t) 64 * n);
+		vector<int> sources(64);
+
+		for (int b = next_batch++; b < batches; b = next_batch++) {
+
+			int first = b * 64;
+			int count = min(64, n - first);
+
+			for (int s = 0; s < count; s++)
+				sources[s] = first + s;
+			fill(rows.begin(), rows.end(), numeric_limits<T>::max());
+
+			// Each newly reached vertex fills a column of the batch rows
+			search.multi_source(sources.data(), count,
+								[&](int v, uint64_t bits, int hops) {
+				while (bits != 0) {
+					int s = __builtin_ctzll(bits);
+					bits &= bits - 1;
+					rows[(size_t) s * n + v] = hops;
+				}
+			});
+
+			for (int s = 0; s < count; s++)
+				consumer(first + s, &rows[(size_t) s * n]);
+		}
+	};
+
+	// Run the batches
+	if (threads == 1)
+		run_batches(0);
+	else
+		getPool().run(run_batches);
+
+	// Return OK
+	return "OK";
+
+}	// end - bfs_all_pairs()
+
+// Johnson all-pairs distances into a row-major V x V matrix
+template <class T>
+string ShortestPath<T>::getJAllPairs(vector<T>& matrix) {
+
+	// Allocate the output matrix
+	matrix.assign((size_t) graph_size * graph_size, numeric_limits<T>::max());
+
+	// Each source owns its row
+	return getJAllPairs([&](int source, const T* row) {
+		copy(row, row + graph_size, matrix.begin() + (size_t) source * graph_size);
+	});
+
+}	// end - getJAllPairs(matrix)
+
+// Get the APSP next-hop recording flag
+template <class T>
+bool ShortestPath<T>::getRecordPaths() {
+	return record_paths;
+}
+
+// Record the next-hop matrix in later APSP runs
+template <class T>
+void ShortestPath<T>::setRecordPaths(bool record) {
+	record_paths = record;
+}
+
+// i -> j path node list from the last recorded APSP run
+template <class T>
+list<int> ShortestPath<T>::apsp_path(int i, int j) {
+	return hops.path(i, j);
+}
+
 // Get the All-Pairs Shortest Path path
 template <class T>
 T ShortestPath<T>::getAPSPShortestShortestPath() {
@@ -449,6 +1521,12 @@ T ShortestPath<T>::getAPSPShortestShortestPath() {
 	// Local shortest-shortest-path variable
 	long ssp = numeric_limits<long>::max();
 
+	// Check for a distance matrix
+	if (!hasAPSPgraph()) {
+		cerr << "No APSP distance matrix" << endl;
+		return ssp;
+	}
+
 	// Find the shortest-shortest path
 	for (int i=0; i<graph_size; i++)
 		for (int j=0; j<graph_size; j++) {
@@ -466,6 +1544,86 @@ T ShortestPath<T>::getAPSPShortestShortestPath() {
 
 }	// end - GetAPSPShortestShortestPath()
 
+// Shortest distance over all pairs i != j
+// A search from s stops once key - h(s) + min(h) can't beat the bound
+template <class T>
+string ShortestPath<T>::getShortestShortestPath() {
+
+	// Define infinity
+	T infinity = numeric_limits<T>::max();
+
+	// Pick up any edge changes
+	refreshList();
+
+	// Graph size
+	int n = SSSPlist.Vertices();
+
+	// Compute the potentials once
+	BellmanFord<T> potentials(SSSPlist);
+	string result = potentials.getPotentials();
+
+	// Check the results for a negative cycle
+	if (!result.compare("NULL"))
+		return "NULL";
+
+	// Keep the potentials
+	setPotentials(potentials.Potentials());
+
+	// Initial bound - every edge is a path
+	T initial = infinity;
+	for (int u=0; u<n; u++)
+		for (int e = SSSPlist.out_begin(u); e < SSSPlist.out_end(u); e++)
+			if (SSSPlist.head(e) != u)
+				initial = min(initial, SSSPlist.weight(e));
+
+	// Shared best-so-far bound
+	atomic<T> best(initial);
+
+	// Next source to run
+	atomic<int> next_source(0);
+
+	// Pruned one-to-all searches
+	auto sources = [&](int) {
+
+		Dijkstra<T> search(SSSPlist, potential.data(), min_potential);
+
+		for (int s = next_source++; s < n; s = next_source++) {
+
+			T hs = potential[s];
+
+			search.run_until(s, [&](int v, T key) {
+
+				// Nothing further from s can beat the bound
+				T bound = best.load(memory_order_relaxed);
+				if (key - hs + min_potential >= bound)
+					return false;
+
+				// Lower the bound
+				if (v != s) {
+					T d = key - hs + potential[v];
+					while (d < bound &&
+						   !best.compare_exchange_weak(bound, d));
+				}
+
+				return true;
+			});
+		}
+	};
+
+	// Run the sources
+	if (threads == 1)
+		sources(0);
+	else
+		getPool().run(sources);
+
+	// Set the shortest path distance
+	shortest_path_distance = best;
+
+	// Return OK
+	return "OK";
+
+}	// end - getShortestShortestPath()
+
 // Create a path node list
 template <class T>
 void ShortestPath<T>::createPath_list() {
@@ -569,5 +1727,66 @@ void ShortestPath<T>::print_APSPgraph(int k) {
 
 }
 
+// Print the Floyd-Warshall thread scaling from 1 to max_threads
+template <class T>
+void ShortestPath<T>::print_APSP_scaling(int max_threads) {
+	print_APSP_scaling(max_threads, sFW);
+}
+
+// Print the thread scaling of an APSP algorithm from 1 to max_threads
+template <class T>
+void ShortestPath<T>::print_APSP_scaling(int max_threads, string algorithm) {
+
+	// Check for a distance matrix
+	if (!hasAPSPgraph()) {
+		cerr << "No APSP distance matrix" << endl;
+		return;
+	}
+
+	// Distance matrix
+	T* D = APSPgraph.APSP_data();
+	size_t cells = (size_t) graph_size * graph_size;
+
+	// Keep the initial distances to restore between runs
+	vector<T> initial(D, D + cells);
+
+	// Restore the configured thread count when done
+	int configured = threads;
+
+	// Single thread time
+	double base = 0;
+
+	cout << algorithm << " scaling (" << graph_size << " vertices):"
+		 << endl << endl;
+
+	for (int t=1; t<=max_threads; t++) {
+
+		// Restore the initial distances
+		copy(initial.begin(), initial.end(), D);
+
+		setThreads(t);
+
+		// Time one run
+		auto begin = chrono::steady_clock::now();
+		string result = getAPSPShortestPath(algorithm);
+		auto end = chrono::steady_clock::now();
+		double ms = chrono::duration<double, milli>(end - begin).count();
+
+		if (t == 1)
+			base = ms;
+
+		// Print the threads, time, speedup and efficiency
+		cout << "threads = " << t
+			 << "  time = " << ms << " ms"
+			 << "  speedup = " << base / ms
+			 << "  efficiency = " << 100.0 * base / (ms * t) << "%"
+			 << "  " << result << endl;
+	}
+	cout << endl;
+
+	setThreads(configured);
+
+}	// end - print_APSP_scaling()
+
 
 #endif /* SHORTESTPATH_H_ */
@@ -11,6 +11,18 @@
 using namespace std;
 
 #include "Graph.h"
+#include "AdjacencyList.h"
+#include "BellmanFord.h"
+#include "Dijkstra.h"
+#include "SSSPCache.h"
+#include "DistanceTable.h"
+#include "BFS.h"
+#include "MinPlus.h"
+#include "HopMatrix.h"
+#include "ThreadPool.h"
+
+#include <chrono>
+#include <atomic>
 
 template <class T>
 class ShortestPath {
@@ -18,7 +30,7 @@ class ShortestPath {
 private:
 
 	// Shortest path distance
-	int shortest_path_distance;
+	T shortest_path_distance;
 
 	// Graph size
 	int graph_size;
@@ -29,11 +41,103 @@ private:
 	// 2-D graph class
 	Graph<T> SSSPgraph;
 
-	// 3-D graph class
+	// Adjacency list of the graph
+	AdjacencyList<T> SSSPlist;
+
+	// SSSPgraph version the adjacency list was built from
+	unsigned long list_version;
+
+	// True if SSSPgraph holds the graph - Dijkstra file constructor
+	bool dense_graph;
+
+	// Shortest-path tree cache, nullptr if disabled
+	SSSPCache<T>* pCache;
+
+	// Rebuild the adjacency list after edge changes
+	void refreshList();
+
+	// Return the tree of a source, from the cache if enabled
+	// nullptr for a negative-cost cycle
+	SSSPTree<T>* getSourceTree(int, SSSPTree<T>&);
+
+	// All-Pairs distance matrix
 	Graph<T> APSPgraph;
 
-	// Vertex adjustment list
-	int* P;
+	// Johnson potentials
+	vector<T> potential;
+
+	// Smallest Johnson potential, 0 without potentials
+	T min_potential;
+
+	// Keep new potentials and their minimum
+	void setPotentials(const vector<T>&);
+
+	// True if the potentials reweight every edge to >= 0
+	bool feasiblePotentials();
+
+	// SSSPlist version the potentials were last checked against
+	unsigned long potential_version;
+
+	// Result of that check, empty if never checked
+	string potential_status;
+
+	// Potentials for searches of the current edges - none for
+	// non-negative edges, Bellman-Ford when an edge is negative
+	// Returns "NULL" for a negative-cost cycle
+	string checkPotentials();
+
+	// Floyd-Warshall tile size
+	int apsp_block;
+
+	// Number of worker threads
+	int threads;
+
+	// Worker thread pool
+	ThreadPool* pPool;
+
+	// Get the worker thread pool
+	ThreadPool& getPool();
+
+	// All-pairs next-hop matrix
+	HopMatrix hops;
+
+	// Record the next-hop matrix during APSP runs
+	bool record_paths;
+
+	// True once APSPgraph holds all-pairs distances
+	bool apsp_valid;
+
+	// True if APSPgraph holds a distance matrix - the Johnson
+	// constructor leaves it empty
+	bool hasAPSPgraph();
+
+	// Treat every edge as weight 1
+	bool unit_weights;
+
+	// True if searches run breadth-first
+	bool useBFS();
+
+	// Breadth-first point-to-point search of a dense graph into the workspace
+	// Returns false on the first edge weight other than 1
+	bool unitShortestPath(Graph<T>&, int, int, Workspace<T>&);
+
+	// Bit-parallel BFS all-pairs hop counts, 64 sources per search
+	string bfs_all_pairs(function<void(int, const T*)>);
+
+	// Blocked Floyd-Warshall, next-hop tracking unless nullptr
+	template <class I>
+	string floyd_warshall(I*);
+
+	// Min-plus repeated squaring, next-hop tracking unless nullptr
+	template <class I>
+	string min_plus(I*);
+
+	// Relax every pair through a shortened edge, O(V^2)
+	template <class I>
+	void relax_edge(int, int, T, I*);
+
+	// Recompute distance matrix rows by Dijkstra
+	string recompute_rows(const vector<int>&);
 
 public:
 
@@ -46,6 +150,7 @@ public:
 	string sD  = "Dijkstra";
 	string sFW = "Floyd-Warshall";
 	string sJ  = "Johnson";
+	string sMP = "Min-Plus";
 
 	// Constructor for Dijkstra graphs
 	ShortestPath(string);
@@ -59,6 +164,19 @@ public:
 	// Get number of nodes
 	int getGraphSize();
 
+	// Get the number of worker threads
+	int getThreads();
+
+	// Get the forced unit-weight flag
+	bool getUnitWeights();
+
+	// Treat every edge as weight 1 - searches return hop counts
+	// Unit-weight graphs are detected at load time without this
+	void setUnitWeights(bool);
+
+	// Set the number of worker threads, 0 = hardware threads
+	void setThreads(int);
+
 	// Get a graph entry
 	T GetGraphEntry(int, int, int);
 
@@ -67,18 +185,87 @@ public:
 
 	// Single-Source Shortest Path
 	// Dijkstra shortest-path algorithm
-	void getShortestPath(Graph<T>, const int, const int);
+	// Reweighted by the Johnson potentials if set - the graph must be
+	// the one this object was loaded from
+	void getShortestPath(Graph<T>&, const int, const int, bool = false);
+
+	// Single-Source Shortest Path tree
+	// Distances and predecessors to every vertex from one search
+	SSSPTree<T> getSingleSource(const int);
+
+	// Source -> target distance, numeric_limits<T>::max() if unreachable
+	// or behind a negative-cost cycle
+	// A cached source is an array lookup
+	T getDistance(const int, const int);
+
+	// Source -> target path node list
+	list<int> getPath(const int, const int);
+
+	// (vertex, distance) of every vertex within a distance of source
+	vector< pair<int, T> > within_radius(const int, T);
+
+	// (vertex, distance) of the k nearest vertices with predicate(vertex)
+	vector< pair<int, T> > k_nearest(const int, int, function<bool(int)>);
+
+	// Many-to-many sources x targets distance table
+	// Bit-parallel BFS on unit-weight graphs, else parallel Dijkstra
+	DistanceTable<T> distance_table(const vector<int>&, const vector<int>&);
+
+	// Cache shortest-path trees within the memory budget, 0 = disable
+	void enableCache(size_t);
+
+	// Print the cache statistics
+	void print_CacheStats();
+
+	// Set the x->y edge value of a Dijkstra graph
+	void set_edge_value(int, int, T);
+
+	// Remove the x->y edge of a Dijkstra graph
+	void remove_edge(int, int);
 
 	// All-Pairs Shortest Path
-	// Floyd-Warshall's shortest-path algorithm
+	// Floyd-Warshall's shortest-path algorithm, or "Min-Plus"
 	string getAPSPShortestPath(string);
 
+	// Min-plus matrix product with repeated squaring
+	string getMinPlusShortestPath();
+
+	// Set the x->y edge value of an APSP graph, infinity removes it
+	// Updates a computed distance matrix in place:
+	// decreases and insertions in O(V^2), increases rerun affected sources
+	// Returns "NULL" and changes nothing for a negative-cost cycle
+	string set_APSP_edge_value(int, int, T);
+
+	// Remove the x->y edge of an APSP graph
+	string remove_APSP_edge(int, int);
+
 	// Johnson's shortest-path algorithm
 	string getJShortestPath(string);
 
+	// Get the APSP next-hop recording flag
+	bool getRecordPaths();
+
+	// Record the next-hop matrix in later APSP runs
+	void setRecordPaths(bool);
+
+	// i -> j path node list from the last recorded APSP run
+	// O(path length), empty if no path or nothing recorded
+	list<int> apsp_path(int, int);
+
+	// Johnson all-pairs rows, streamed to a consumer(source, row)
+	string getJAllPairs(function<void(int, const T*)>);
+
+	// Johnson all-pairs distances into a row-major matrix
+	string getJAllPairs(vector<T>&);
+
 	// Get the APSP Shortest-shortest path
 	T getAPSPShortestShortestPath();
 
+	// Shortest distance over all pairs i != j without an APSP matrix
+	// Pruned parallel Johnson searches sharing a best-so-far bound
+	// Read the result with getShortestPathDistance()
+	string getShortestShortestPath();
+
 	// Generate the path node list
 	void genPathNodeList(vector<T>&, int);
 
@@ -89,6 +276,12 @@ public:
 
 	void print_APSPgraph(int);
 
+	// Print the Floyd-Warshall thread scaling
+	void print_APSP_scaling(int);
+
+	// Print the thread scaling of an APSP algorithm
+	void print_APSP_scaling(int, string);
+
 };
 
 #endif /* SHORTESTPATH_CLASS_H_ */
@@ -0,0 +1,134 @@
+/*
+ * SpanningForest.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef SPANNINGFOREST_H_
+#define SPANNINGFOREST_H_
+
+#include <algorithm>
+
+#include "SpanningForest_class.h"
+
+
+// Constructors
+
+// Empty forest
+template <class T>
+SpanningForest<T>::SpanningForest():vertices(0) {
+}
+
+// Minimum spanning forest on the specified number of threads
+template <class T>
+SpanningForest<T>::SpanningForest(Graph<T>& graph, int threads):
+											vertices(graph.Vertices()) {
+
+	// The edge list - row-major, so ties break like Kruskal
+	EdgeList<T> list(graph);
+	int count = list.size();
+
+	// Worker threads
+	ThreadPool pool(threads);
+	int workers = pool.Threads();
+
+	// Label the components - concurrent merges over edge ranges
+	ConcurrentDisjointSet sets(vertices);
+	pool.run([&](int id) {
+
+		int first = (long) count * id / workers;
+		int last = (long) count * (id + 1) / workers;
+
+		for (int e = first; e < last; e++)
+			sets.merge(list[e].u, list[e].v);
+	});
+
+	// Point every vertex at its root
+	pool.run([&](int id) {
+
+		for (int v = id; v < vertices; v += workers)
+			sets.flatten(v);
+	});
+
+	// Roots are the smallest vertex of each component - number them in order
+	label.assign(vertices, -1);
+	int components = 0;
+	for (int v = 0; v < vertices; v++) {
+		int root = sets.find(v);
+		if (root == v)
+			label[v] = components++;
+		label[v] = label[root];
+	}
+
+	// Vertex counts, and each vertex's index inside its component
+	component_size.assign(components, 0);
+	vector<int> local(vertices);
+	for (int v = 0; v < vertices; v++)
+		local[v] = component_size[label[v]]++;
+
+	// Bucket the edges by component - edge order is kept inside a bucket
+	vector<int> start(components + 1, 0);
+	for (int e = 0; e < count; e++)
+		start[label[list[e].u] + 1]++;
+	for (int c = 0; c < components; c++)
+		start[c + 1] += start[c];
+
+	vector< Edge<T> > bucket(count);
+	vector<int> fill(start.begin(), start.end() - 1);
+	for (int e = 0; e < count; e++)
+		bucket[fill[label[list[e].u]]++] = list[e];
+
+	// Largest components first so small ones fill in around them
+	vector<int> order(components);
+	for (int c = 0; c < components; c++)
+		order[c] = c;
+	stable_sort(order.begin(), order.end(), [&](int a, int b) {
+		return start[a + 1] - start[a] > start[b + 1] - start[b];
+	});
+
+	trees.assign(components, vector< Edge<T> >());
+	distances.assign(components, 0);
+
+	// One Kruskal task per component, handed out in order
+	atomic<int> next(0);
+	pool.run([&](int) {
+
+		for (int i = next++; i < components; i = next++) {
+
+			int c = order[i];
+			Edge<T>* first = bucket.data() + start[c];
+			Edge<T>* last = bucket.data() + start[c + 1];
+
+			// Isolated vertex
+			if (component_size[c] < 2)
+				continue;
+
+			sort_edges(first, last);
+
+			// Kruskal over the component's local vertex indices
+			trees[c] = kruskal_tree(first, last, component_size[c], local.data());
+
+			// Accumulate the total cost
+			for (auto &edge : trees[c])
+				distances[c] += edge.weight;
+		}
+	});
+
+}	// end - SpanningForest(Graph)
+
+// Methods
+
+// Return the distance of the whole forest
+template <class T>
+T SpanningForest<T>::total() const {
+
+	T sum = 0;
+	for (auto distance : distances)
+		sum += distance;
+
+	return sum;
+
+}	// end - total()
+
+#endif /* SPANNINGFOREST_H_ */
@@ -0,0 +1,89 @@
+/*
+ * SpanningForest_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef SPANNINGFOREST_CLASS_H_
+#define SPANNINGFOREST_CLASS_H_
+
+#include <vector>
+#include <atomic>
+
+using namespace std;
+
+#include "Graph.h"
+#include "EdgeList.h"
+#include "DisjointSet.h"
+#include "ThreadPool.h"
+
+
+// Minimum spanning forest - one minimum spanning tree per component
+// Components are labeled in parallel, then each component's tree is built
+// by Kruskal as an independent task, largest components first
+template <class T>
+class SpanningForest {
+
+private:
+
+	// Number of vertices
+	int vertices;
+
+	// Component of each vertex, numbered by smallest vertex
+	vector<int> label;
+
+	// Vertex count of each component
+	vector<int> component_size;
+
+	// Tree edges of each component
+	vector< vector< Edge<T> > > trees;
+
+	// Tree distance of each component
+	vector<T> distances;
+
+public:
+
+	// Empty forest
+	SpanningForest();
+
+	// Minimum spanning forest on the specified number of threads,
+	// 0 = hardware
+	SpanningForest(Graph<T>&, int);
+
+	// Return the number of vertices
+	int Vertices() const {
+		return vertices;
+	}
+
+	// Return the number of components
+	int Components() const {
+		return trees.size();
+	}
+
+	// Return the component of a vertex
+	int component(int v) const {
+		return label[v];
+	}
+
+	// Return the vertex count of a component
+	int size(int c) const {
+		return component_size[c];
+	}
+
+	// Return the tree edges of a component
+	const vector< Edge<T> >& edges(int c) const {
+		return trees[c];
+	}
+
+	// Return the tree distance of a component
+	T distance(int c) const {
+		return distances[c];
+	}
+
+	// Return the distance of the whole forest
+	T total() const;
+
+};	// end - SpanningForest class
+
+#endif /* SPANNINGFOREST_CLASS_H_ */
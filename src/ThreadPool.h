@@ -0,0 +1,140 @@
+/*
+ * ThreadPool.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+#include "ThreadPool_class.h"
+
+
+// Barrier
+
+// Barrier for the specified number of threads
+inline Barrier::Barrier(int threads):threads(threads),
+									 waiting(0),
+									 generation(0) {
+}
+
+// Block until every thread has arrived
+inline void Barrier::wait() {
+
+	unique_lock<mutex> guard(lock);
+
+	// Last arrival opens the barrier
+	unsigned long arrival = generation;
+	if (++waiting == threads) {
+		waiting = 0;
+		generation++;
+		released.notify_all();
+		return;
+	}
+
+	// Wait for this generation to open
+	released.wait(guard, [&] { return generation != arrival; });
+
+}	// end - wait()
+
+
+// ThreadPool
+
+// Pool of the specified number of threads
+inline ThreadPool::ThreadPool(int size):threads(size),
+										pending(0),
+										generation(0),
+										stop(false) {
+
+	// Default to the hardware threads
+	if (threads < 1)
+		threads = hardware_threads();
+
+	// Start the workers - the caller is worker 0
+	for (int i = 1; i < threads; i++)
+		workers.push_back(thread(&ThreadPool::worker, this, i));
+
+}	// end - ThreadPool()
+
+// Joins the workers
+inline ThreadPool::~ThreadPool() {
+
+	// Signal the shutdown
+	{
+		lock_guard<mutex> guard(lock);
+		stop = true;
+	}
+	start.notify_all();
+
+	// Wait for the workers
+	for (auto &w : workers)
+		w.join();
+
+}	// end - ~ThreadPool()
+
+// Return the number of threads
+inline int ThreadPool::Threads() {
+	return threads;
+}
+
+// Return the default number of threads
+inline int ThreadPool::hardware_threads() {
+
+	int count = thread::hardware_concurrency();
+
+	return (count > 0) ? count : 1;
+}
+
+// Worker thread loop
+inline void ThreadPool::worker(int index) {
+
+	// Last task generation run by this worker
+	unsigned long seen = 0;
+
+	while (true) {
+
+		// Wait for a new task or shutdown
+		{
+			unique_lock<mutex> guard(lock);
+			start.wait(guard, [&] { return stop || generation != seen; });
+			if (stop)
+				return;
+			seen = generation;
+		}
+
+		// Run this worker's share
+		task(index);
+
+		// Report completion
+		{
+			lock_guard<mutex> guard(lock);
+			if (--pending == 0)
+				done.notify_one();
+		}
+	}
+
+}	// end - worker()
+
+// Run task(index) on every thread and wait for all of them
+inline void ThreadPool::run(function<void(int)> job) {
+
+	// Dispatch to the workers
+	{
+		lock_guard<mutex> guard(lock);
+		task = job;
+		pending = threads - 1;
+		generation++;
+	}
+	start.notify_all();
+
+	// The caller is worker 0
+	task(0);
+
+	// Wait for the workers
+	unique_lock<mutex> guard(lock);
+	done.wait(guard, [&] { return pending == 0; });
+
+}	// end - run()
+
+#endif /* THREADPOOL_H_ */
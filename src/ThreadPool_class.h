@@ -0,0 +1,97 @@
+/*
+ * ThreadPool_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef THREADPOOL_CLASS_H_
+#define THREADPOOL_CLASS_H_
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+using namespace std;
+
+
+// Reusable barrier for a fixed number of threads
+class Barrier {
+
+private:
+
+	mutex lock;
+	condition_variable released;
+
+	// Number of participating threads
+	int threads;
+
+	// Threads waiting in the current generation
+	int waiting;
+
+	// Incremented each time the barrier opens
+	unsigned long generation;
+
+public:
+
+	// Barrier for the specified number of threads
+	Barrier(int);
+
+	// Block until every thread has arrived
+	void wait();
+
+};	// end - Barrier class
+
+
+// Fixed pool of worker threads running one task per dispatch
+class ThreadPool {
+
+private:
+
+	// Worker threads - the calling thread is worker 0
+	vector<thread> workers;
+
+	// Current task, called with the worker index
+	function<void(int)> task;
+
+	mutex lock;
+	condition_variable start;
+	condition_variable done;
+
+	// Number of threads including the caller
+	int threads;
+
+	// Workers still running the current task
+	int pending;
+
+	// Incremented for each dispatched task
+	unsigned long generation;
+
+	// Shutdown flag
+	bool stop;
+
+	// Worker thread loop
+	void worker(int);
+
+public:
+
+	// Pool of the specified number of threads, 0 = hardware threads
+	ThreadPool(int);
+
+	// Joins the workers
+	~ThreadPool();
+
+	// Return the number of threads
+	int Threads();
+
+	// Run task(index) on every thread and wait for all of them
+	void run(function<void(int)>);
+
+	// Return the default number of threads
+	static int hardware_threads();
+
+};	// end - ThreadPool class
+
+#endif /* THREADPOOL_CLASS_H_ */
@@ -0,0 +1,55 @@
+/*
+ * Workspace.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef WORKSPACE_H_
+#define WORKSPACE_H_
+
+#include "Workspace_class.h"
+
+
+// Empty workspace
+template <class T>
+Workspace<T>::Workspace():epoch(0) {
+}
+
+// Start a new query
+template <class T>
+void Workspace<T>::reset(int size) {
+
+	// Grow the arrays - only allocates when a larger graph is seen
+	if ((int) labeled.size() < size) {
+		labeled.resize(size, 0);
+		settled.resize(size, 0);
+		dist.resize(size);
+		pred.resize(size);
+	}
+
+	// A new epoch invalidates every entry
+	if (++epoch == 0) {
+
+		// Wrapped around - clear the tags once every 2^32 queries
+		fill(labeled.begin(), labeled.end(), 0);
+		fill(settled.begin(), settled.end(), 0);
+		epoch = 1;
+	}
+
+	// Keeps the capacity
+	touched.clear();
+	heap.clear();
+
+}	// end - reset()
+
+// The calling thread's workspace
+template <class T>
+Workspace<T>& Workspace<T>::local() {
+
+	static thread_local Workspace<T> workspace;
+
+	return workspace;
+}
+
+#endif /* WORKSPACE_H_ */
@@ -0,0 +1,125 @@
+/*
+ * Workspace_class.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef WORKSPACE_CLASS_H_
+#define WORKSPACE_CLASS_H_
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+using namespace std;
+
+
+// Reusable search state for graph queries
+// Entries are tagged with the current epoch, so reset() only costs
+// O(vertices touched by the previous query) once the arrays are sized
+template <class T>
+class Workspace {
+
+private:
+
+	// Epoch of the current query
+	unsigned epoch;
+
+	// Epoch in which each vertex was labeled
+	vector<unsigned> labeled;
+
+	// Epoch in which each vertex was settled
+	vector<unsigned> settled;
+
+	// Tentative distance of each labeled vertex
+	vector<T> dist;
+
+	// Predecessor of each labeled vertex
+	vector<int> pred;
+
+	// Vertices labeled in the current query, in labeling order
+	vector<int> touched;
+
+	// Min-heap of (distance, vertex)
+	vector< pair<T, int> > heap;
+
+public:
+
+	// Empty workspace
+	Workspace();
+
+	// Start a new query over the specified number of vertices
+	void reset(int);
+
+	// Return true if the vertex was labeled in this query
+	bool reached(int v) const {
+		return labeled[v] == epoch;
+	}
+
+	// Return the distance of a vertex, infinity if not labeled
+	T distance(int v) const {
+		return (labeled[v] == epoch) ? dist[v] : numeric_limits<T>::max();
+	}
+
+	// Return the predecessor of a vertex, -1 if not labeled
+	int predecessor(int v) const {
+		return (labeled[v] == epoch) ? pred[v] : -1;
+	}
+
+	// Set the distance and predecessor of a vertex
+	void label(int v, T d, int p) {
+		if (labeled[v] != epoch) {
+			labeled[v] = epoch;
+			touched.push_back(v);
+		}
+		dist[v] = d;
+		pred[v] = p;
+	}
+
+	// Return true if the vertex was settled in this query
+	bool is_settled(int v) const {
+		return settled[v] == epoch;
+	}
+
+	// Mark a vertex settled
+	void settle(int v) {
+		settled[v] = epoch;
+	}
+
+	// Vertices labeled in this query
+	const vector<int>& Touched() const {
+		return touched;
+	}
+
+	// Push a heap entry
+	void push(T d, int v) {
+		heap.push_back(make_pair(d, v));
+		push_heap(heap.begin(), heap.end(), greater< pair<T, int> >());
+	}
+
+	// Pop the minimum heap entry
+	pair<T, int> pop() {
+		pop_heap(heap.begin(), heap.end(), greater< pair<T, int> >());
+		pair<T, int> top = heap.back();
+		heap.pop_back();
+		return top;
+	}
+
+	// Return the minimum heap entry
+	const pair<T, int>& top() const {
+		return heap.front();
+	}
+
+	// Return true if the heap is empty
+	bool empty() const {
+		return heap.empty();
+	}
+
+	// The calling thread's workspace
+	static Workspace<T>& local();
+
+};	// end - Workspace class
+
+#endif /* WORKSPACE_CLASS_H_ */
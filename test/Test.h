@@ -0,0 +1,147 @@
+/*
+ * Test.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#ifndef TEST_H_
+#define TEST_H_
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <limits>
+#include <random>
+#include <cstdio>
+
+using namespace std;
+
+
+// Minimal test harness - each test program returns the failure count
+
+// Number of failed checks
+static int test_failures = 0;
+
+// Record a failed check with its location
+#define CHECK(condition) \
+	do { \
+		if (!(condition)) { \
+			test_failures++; \
+			cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" \
+				 << #condition << ") failed" << endl; \
+		} \
+	} while (0)
+
+// Check two values for equality, printing both on failure
+#define CHECK_EQUAL(expected, actual) \
+	do { \
+		auto test_expected = (expected); \
+		auto test_actual = (actual); \
+		if (!(test_expected == test_actual)) { \
+			test_failures++; \
+			cerr << __FILE__ << ":" << __LINE__ << ": " << #actual \
+				 << " = " << test_actual << ", expected " \
+				 << test_expected << endl; \
+		} \
+	} while (0)
+
+// Print the summary and return the exit code
+inline int test_result(const char* name) {
+
+	if (test_failures)
+		cout << name << ": " << test_failures << " failed checks" << endl;
+	else
+		cout << name << ": OK" << endl;
+
+	return test_failures ? 1 : 0;
+
+}	// end - test_result()
+
+// Weighted directed edge, 0-based
+struct TestEdge {
+	int u;
+	int v;
+	long weight;
+};
+
+// Write a graph file - "n m" then 1-based "u v w" lines
+inline string write_graph(string file_name, int n, const vector<TestEdge>& edges) {
+
+	ofstream data_file(file_name);
+	data_file << n << " " << edges.size() << endl;
+	for (auto &e : edges)
+		data_file << e.u + 1 << " " << e.v + 1 << " " << e.weight << endl;
+
+	return file_name;
+
+}	// end - write_graph()
+
+// Random simple digraph with m edges and weights in [low, high]
+// shift adds h[u] - h[v] for random h in [0, shift] - negative weights,
+// but no negative cycles when low > 0
+inline vector<TestEdge> random_graph(mt19937& random, int n, int m,
+									 long low, long high, long shift = 0) {
+
+	// Random potentials for the shift
+	vector<long> h(n);
+	for (auto &x : h)
+		x = (long) (random() % (shift + 1));
+
+	// No parallel edges or self loops
+	vector<char> used((size_t) n * n, 0);
+	vector<TestEdge> edges;
+	for (int tries = 0; (int) edges.size() < m && tries < 20 * m; tries++) {
+
+		int u = random() % n;
+		int v = random() % n;
+		if (u == v || used[(size_t) u * n + v])
+			continue;
+		used[(size_t) u * n + v] = 1;
+
+		long w = low + (long) (random() % (high - low + 1));
+
+		// Graph treats 0 as a missing edge
+		w += h[u] - h[v];
+		if (w == 0)
+			w = 1;
+
+		edges.push_back(TestEdge{u, v, w});
+	}
+
+	return edges;
+
+}	// end - random_graph()
+
+// Reference all-pairs distances by plain Floyd-Warshall
+// Unreachable is numeric_limits<long>::max(), false on a negative cycle
+inline bool reference_apsp(int n, const vector<TestEdge>& edges,
+						   vector< vector<long> >& D) {
+
+	const long infinity = numeric_limits<long>::max();
+
+	D.assign(n, vector<long>(n, infinity));
+	for (int i = 0; i < n; i++)
+		D[i][i] = 0;
+	for (auto &e : edges)
+		D[e.u][e.v] = min(D[e.u][e.v], e.weight);
+
+	for (int k = 0; k < n; k++)
+		for (int i = 0; i < n; i++) {
+			if (D[i][k] == infinity)
+				continue;
+			for (int j = 0; j < n; j++)
+				if (D[k][j] != infinity && D[i][k] + D[k][j] < D[i][j])
+					D[i][j] = D[i][k] + D[k][j];
+		}
+
+	for (int i = 0; i < n; i++)
+		if (D[i][i] < 0)
+			return false;
+
+	return true;
+
+}	// end - reference_apsp()
+
+#endif /* TEST_H_ */
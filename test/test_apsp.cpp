@@ -0,0 +1,517 @@
+/*
+ * test_apsp.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#include "Test.h"
+
+using namespace std;
+
+#include "ShortestPath.h"
+
+
+// Temporary graph file
+const string GRAPH = "test_apsp.graph";
+
+// Compare a computed matrix to the reference
+template <class Get>
+int mismatches(int n, const vector< vector<long> >& D, Get get) {
+
+	int bad = 0;
+	for (int i = 0; i < n; i++)
+		for (int j = 0; j < n; j++)
+			if (get(i, j) != D[i][j])
+				bad++;
+
+	return bad;
+
+}	// end - mismatches()
+
+// A cycle of the given length with total weight -1
+// Plus a tail vertex unless alone
+void write_cycle(int length, bool alone) {
+
+	vector<TestEdge> edges;
+	for (int i = 0; i < length; i++)
+		edges.push_back(TestEdge{i, (i + 1) % length, i ? 1 : -length});
+	if (!alone)
+		edges.push_back(TestEdge{length - 1, length, 5});
+
+	write_graph(GRAPH, alone ? length : length + 1, edges);
+
+}	// end - write_cycle()
+
+// Row kernel against a wide reference, saturating at both ends
+template <class T>
+void test_kernel(mt19937& random) {
+
+	const T infinity = numeric_limits<T>::max();
+	const T lowest = numeric_limits<T>::lowest();
+
+	// Values near zero and near both limits
+	auto value = [&]() -> T {
+		switch (random() % 6) {
+		case 0:
+			return infinity;
+		case 1:
+			return infinity - (T) (random() % 100);
+		case 2:
+			return lowest + (T) (random() % 100);
+		default:
+			return (T) ((long) (random() % 2001) - 1000);
+		}
+	};
+
+	int bad = 0;
+	for (int trial = 0; trial < 2000; trial++) {
+
+		// Odd lengths leave a scalar tail after the vector body
+		int len = 1 + random() % 70;
+		vector<T> dst(len);
+		vector<T> src(len);
+		for (int j = 0; j < len; j++) {
+			dst[j] = value();
+			src[j] = value();
+		}
+
+		T dik = value();
+		if (dik == infinity)
+			dik = 0;
+
+		vector<T> expected(dst);
+		for (int j = 0; j < len; j++) {
+			__int128 sum = (__int128) dik + src[j];
+			T clamped = (src[j] == infinity || sum >= infinity) ? infinity
+					  : (sum < lowest) ? lowest : (T) sum;
+			expected[j] = min(expected[j], clamped);
+		}
+
+		minplus_row(dst.data(), src.data(), dik, len);
+		bad += dst != expected;
+	}
+	CHECK_EQUAL(0, bad);
+
+}	// end - test_kernel()
+
+// Multithreaded blocked Floyd-Warshall against the reference
+void test_floyd_warshall(mt19937& random, int n, int m, long shift, int threads) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 50, shift);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+
+	ShortestPath<long> apsp(GRAPH, "Floyd-Warshall");
+	apsp.setThreads(threads);
+
+	CHECK_EQUAL(string("OK"), apsp.getAPSPShortestPath(apsp.sFW));
+	CHECK_EQUAL(0, mismatches(n, D, [&](int i, int j) {
+		return apsp.GetGraphEntry(i, j, 1);
+	}));
+
+}	// end - test_floyd_warshall()
+
+// Floyd-Warshall reports a negative-cost cycle as "NULL"
+void test_floyd_warshall_cycle(int length) {
+
+	for (bool alone : {false, true}) {
+		write_cycle(length, alone);
+		ShortestPath<long> fw(GRAPH, "Floyd-Warshall");
+		fw.setThreads(2);
+		CHECK_EQUAL(string("NULL"), fw.getAPSPShortestPath(fw.sFW));
+	}
+
+}	// end - test_floyd_warshall_cycle()
+
+// Bellman-Ford potentials reweight every edge to >= 0
+void test_potentials(mt19937& random, int n, int m) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 20, 40);
+	write_graph(GRAPH, n, edges);
+
+	AdjacencyList<long> list(GRAPH);
+	BellmanFord<long> potentials(list);
+	CHECK_EQUAL(string("OK"), potentials.getPotentials());
+
+	vector<long> h = potentials.Potentials();
+	CHECK_EQUAL((size_t) n, h.size());
+	if (h.size() != (size_t) n)
+		return;
+
+	int bad = 0;
+	for (auto &e : edges)
+		bad += e.weight + h[e.u] - h[e.v] < 0;
+	CHECK_EQUAL(0, bad);
+
+}	// end - test_potentials()
+
+// Johnson reports a negative-cost cycle as "NULL"
+void test_johnson_cycle(int length) {
+
+	for (bool alone : {false, true}) {
+		write_cycle(length, alone);
+		ShortestPath<long> johnson(GRAPH, "Johnson");
+		vector<long> matrix;
+		CHECK_EQUAL(string("NULL"), johnson.getJAllPairs(matrix));
+	}
+
+}	// end - test_johnson_cycle()
+
+// The Johnson constructor has no distance matrix for the APSP entry points
+void test_no_matrix(mt19937& random) {
+
+	write_graph(GRAPH, 20, random_graph(random, 20, 60, 1, 10));
+
+	ShortestPath<long> johnson(GRAPH, "Johnson");
+	CHECK_EQUAL(string("NULL"), johnson.getAPSPShortestPath(johnson.sFW));
+	CHECK_EQUAL(string("NULL"), johnson.getMinPlusShortestPath());
+	CHECK_EQUAL(string("NULL"), johnson.set_APSP_edge_value(0, 1, 3));
+	CHECK_EQUAL(numeric_limits<long>::max(),
+				johnson.getAPSPShortestShortestPath());
+	CHECK_EQUAL(numeric_limits<long>::max(), johnson.GetGraphEntry(0, 1, 0));
+	johnson.print_APSP_scaling(2);
+
+	// A missing file leaves no graph at all
+	ShortestPath<long> missing("test_apsp.missing", "Floyd-Warshall");
+	CHECK_EQUAL(string("NULL"), missing.getAPSPShortestPath(missing.sFW));
+
+}	// end - test_no_matrix()
+
+// Parallel Johnson rows against the reference
+void test_johnson(mt19937& random, int n, int m, long shift, int threads) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 50, shift);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+
+	ShortestPath<long> johnson(GRAPH, "Johnson");
+	johnson.setThreads(threads);
+
+	// Into a matrix
+	vector<long> matrix;
+	CHECK_EQUAL(string("OK"), johnson.getJAllPairs(matrix));
+	CHECK_EQUAL(0, mismatches(n, D, [&](int i, int j) {
+		return matrix[(size_t) i * n + j];
+	}));
+
+	// Streamed - every row exactly once
+	vector<int> seen(n, 0);
+	int bad = 0;
+	mutex lock;
+	CHECK_EQUAL(string("OK"), johnson.getJAllPairs([&](int s, const long* row) {
+		lock_guard<mutex> guard(lock);
+		seen[s]++;
+		for (int j = 0; j < n; j++)
+			bad += row[j] != D[s][j];
+	}));
+	CHECK_EQUAL(0, bad);
+	CHECK(seen == vector<int>(n, 1));
+
+}	// end - test_johnson()
+
+// Potentials past the int range through the dense Dijkstra search
+void test_long_potentials() {
+
+	// 0 -> 1 -> 2 -> 3 at -2e9 each, plus a 0 -> 3 shortcut
+	vector<TestEdge> edges;
+	for (int i = 0; i < 3; i++)
+		edges.push_back(TestEdge{i, i + 1, -2000000000L});
+	edges.push_back(TestEdge{0, 3, 7});
+	write_graph(GRAPH, 4, edges);
+
+	ShortestPath<long> johnson(GRAPH, "Johnson");
+	vector<long> matrix;
+	CHECK_EQUAL(string("OK"), johnson.getJAllPairs(matrix));
+	CHECK_EQUAL(-6000000000L, matrix[3]);
+
+	Graph<long> graph(GRAPH);
+	johnson.getShortestPath(graph, 0, 3, true);
+	CHECK_EQUAL(-6000000000L, johnson.getShortestPathDistance());
+
+}	// end - test_long_potentials()
+
+// Product tile kernel against a wide reference, saturating at both ends
+template <class T>
+void test_gemm_kernel(mt19937& random) {
+
+	const T infinity = numeric_limits<T>::max();
+	const T lowest = numeric_limits<T>::lowest();
+
+	// Values near zero and near both limits
+	auto value = [&]() -> T {
+		switch (random() % 6) {
+		case 0:
+			return infinity;
+		case 1:
+			return infinity - (T) (random() % 100);
+		case 2:
+			return lowest + (T) (random() % 100);
+		default:
+			return (T) ((long) (random() % 2001) - 1000);
+		}
+	};
+
+	int bad = 0;
+	for (int trial = 0; trial < 200; trial++) {
+
+		// Row and column ranges that leave partial register tiles
+		int n = 1 + random() % 90;
+		int i0 = random() % n, i1 = i0 + 1 + random() % (n - i0);
+		int j0 = random() % n, j1 = j0 + 1 + random() % (n - j0);
+		int k0 = random() % n, k1 = k0 + 1 + random() % (n - k0);
+
+		size_t cells = (size_t) n * n;
+		vector<T> A(cells), B(cells), C(cells);
+		for (size_t c = 0; c < cells; c++) {
+			A[c] = value();
+			B[c] = value();
+			C[c] = value();
+		}
+
+		vector<T> expected(C);
+		for (int i = i0; i < i1; i++)
+			for (int k = k0; k < k1; k++) {
+				T aik = A[(size_t) i * n + k];
+				if (aik == infinity)
+					continue;
+				for (int j = j0; j < j1; j++) {
+					T bkj = B[(size_t) k * n + j];
+					__int128 sum = (__int128) aik + bkj;
+					T clamped = (bkj == infinity || sum >= infinity) ? infinity
+							  : (sum < lowest) ? lowest : (T) sum;
+					T& cij = expected[(size_t) i * n + j];
+					cij = min(cij, clamped);
+				}
+			}
+
+		minplus_gemm_block(C.data(), A.data(), B.data(), n, i0, i1, j0, j1, k0, k1);
+		bad += C != expected;
+	}
+	CHECK_EQUAL(0, bad);
+
+}	// end - test_gemm_kernel()
+
+// Min-plus repeated squaring against the reference
+void test_min_plus(mt19937& random, int n, int m, long shift, int threads) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 50, shift);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+
+	ShortestPath<long> apsp(GRAPH, "Floyd-Warshall");
+	apsp.setThreads(threads);
+
+	CHECK_EQUAL(string("OK"), apsp.getMinPlusShortestPath());
+	CHECK_EQUAL(0, mismatches(n, D, [&](int i, int j) {
+		return apsp.GetGraphEntry(i, j, 1);
+	}));
+
+}	// end - test_min_plus()
+
+// Squaring covers cycles through every vertex
+void test_min_plus_cycle(int length) {
+
+	for (bool alone : {false, true})
+		for (bool record : {false, true}) {
+			write_cycle(length, alone);
+			ShortestPath<long> mp(GRAPH, "Floyd-Warshall");
+			mp.setRecordPaths(record);
+			CHECK_EQUAL(string("NULL"), mp.getMinPlusShortestPath());
+		}
+
+}	// end - test_min_plus_cycle()
+
+// Recorded next hops rebuild real paths of the shortest length
+void test_paths(mt19937& random, int n, int m, long shift, int threads) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 50, shift);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+
+	// Edge weight lookup, 0 = none
+	vector< vector<long> > W(n, vector<long>(n, 0));
+	for (auto &e : edges)
+		W[e.u][e.v] = e.weight;
+
+	for (string algorithm : {"Floyd-Warshall", "Min-Plus"}) {
+
+		ShortestPath<long> apsp(GRAPH, "Floyd-Warshall");
+		apsp.setThreads(threads);
+		apsp.setRecordPaths(true);
+
+		CHECK_EQUAL(string("OK"), apsp.getAPSPShortestPath(algorithm));
+		CHECK_EQUAL(0, mismatches(n, D, [&](int i, int j) {
+			return apsp.GetGraphEntry(i, j, 1);
+		}));
+
+		int bad = 0;
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < n; j++) {
+
+				list<int> path = apsp.apsp_path(i, j);
+				if (D[i][j] == numeric_limits<long>::max()) {
+					bad += !path.empty();
+					continue;
+				}
+
+				long length = 0;
+				int previous = -1;
+				for (int v : path) {
+					if (previous >= 0) {
+						bad += W[previous][v] == 0;
+						length += W[previous][v];
+					}
+					previous = v;
+				}
+				bad += path.front() != i || path.back() != j || length != D[i][j];
+			}
+		CHECK_EQUAL(0, bad);
+	}
+
+}	// end - test_paths()
+
+// Incremental edge updates against a full recomputation
+void test_updates(mt19937& random, int n, int m) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 30);
+	write_graph(GRAPH, n, edges);
+
+	ShortestPath<long> apsp(GRAPH, "Floyd-Warshall");
+	apsp.setThreads(2);
+	CHECK_EQUAL(string("OK"), apsp.getAPSPShortestPath(apsp.sFW));
+
+	// Current edge weights, 0 = none
+	vector< vector<long> > W(n, vector<long>(n, 0));
+	for (auto &e : edges)
+		W[e.u][e.v] = e.weight;
+
+	for (int op = 0; op < 60; op++) {
+
+		int x = random() % n;
+		int y = random() % n;
+		if (x == y)
+			continue;
+
+		// Remove, raise or lower an edge
+		long value = (random() % 4 == 0) ? numeric_limits<long>::max()
+										 : (long) (random() % 40) - 3;
+		if (value == 0)
+			value = 1;
+
+		// Reference with the change
+		vector<TestEdge> changed;
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < n; j++) {
+				long w = (i == x && j == y) ? value : W[i][j];
+				if (w != 0 && w != numeric_limits<long>::max())
+					changed.push_back(TestEdge{i, j, w});
+			}
+
+		vector< vector<long> > D;
+		bool valid = reference_apsp(n, changed, D);
+
+		string result = apsp.set_APSP_edge_value(x, y, value);
+
+		// A negative cycle is rejected and nothing changes
+		if (!valid) {
+			CHECK_EQUAL(string("NULL"), result);
+			continue;
+		}
+
+		CHECK_EQUAL(string("OK"), result);
+		W[x][y] = (value == numeric_limits<long>::max()) ? 0 : value;
+		CHECK_EQUAL(0, mismatches(n, D, [&](int i, int j) {
+			return apsp.GetGraphEntry(i, j, 1);
+		}));
+	}
+
+}	// end - test_updates()
+
+// Pruned global minimum against the reference
+void test_shortest_shortest(mt19937& random, int n, int m, long shift,
+							int threads) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 50, shift);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+
+	// Minimum over i != j
+	long best = numeric_limits<long>::max();
+	for (int i = 0; i < n; i++)
+		for (int j = 0; j < n; j++)
+			if (i != j)
+				best = min(best, D[i][j]);
+
+	ShortestPath<long> johnson(GRAPH, "Johnson");
+	johnson.setThreads(threads);
+	CHECK_EQUAL(string("OK"), johnson.getShortestShortestPath());
+	CHECK_EQUAL(best, johnson.getShortestPathDistance());
+
+	// A negative cycle has no minimum
+	write_cycle(3, false);
+	ShortestPath<long> cycle(GRAPH, "Johnson");
+	CHECK_EQUAL(string("NULL"), cycle.getShortestShortestPath());
+
+}	// end - test_shortest_shortest()
+
+int main() {
+
+	mt19937 random(2026);
+
+	// 32 and 64-bit kernels of whichever instruction set this CPU has
+	test_kernel<int>(random);
+	test_kernel<long>(random);
+
+	// Sizes around the 64-vertex tile
+	test_floyd_warshall(random, 2, 1, 0, 1);
+	test_floyd_warshall(random, 40, 200, 0, 1);
+	test_floyd_warshall(random, 97, 600, 20, 4);
+	test_floyd_warshall(random, 300, 3000, 0, 4);
+	for (int length : {2, 3, 5})
+		test_floyd_warshall_cycle(length);
+
+	test_potentials(random, 80, 400);
+	for (int length : {2, 3, 5})
+		test_johnson_cycle(length);
+	test_no_matrix(random);
+
+	test_johnson(random, 60, 300, 0, 1);
+	test_johnson(random, 120, 900, 30, 4);
+	test_long_potentials();
+
+	// Register tiles of whichever instruction set this CPU has
+	test_gemm_kernel<int>(random);
+	test_gemm_kernel<long>(random);
+
+	test_min_plus(random, 2, 1, 0, 1);
+	test_min_plus(random, 40, 200, 0, 1);
+	test_min_plus(random, 97, 600, 20, 4);
+	test_min_plus(random, 300, 3000, 0, 4);
+	for (int length : {2, 3, 5})
+		test_min_plus_cycle(length);
+
+	// Around the 256-vertex hop width
+	test_paths(random, 40, 200, 0, 1);
+	test_paths(random, 97, 600, 20, 4);
+	test_paths(random, 300, 3000, 0, 4);
+
+	test_updates(random, 30, 120);
+
+	test_shortest_shortest(random, 60, 300, 0, 1);
+	test_shortest_shortest(random, 120, 900, 30, 4);
+
+	remove(GRAPH.c_str());
+	return test_result("test_apsp");
+
+}	// end - main()
@@ -0,0 +1,119 @@
+/*
+ * test_ch.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#include "Test.h"
+
+using namespace std;
+
+#include "ContractionHierarchy.h"
+
+
+// Temporary files
+const string GRAPH = "test_ch.graph";
+const string HIERARCHY = "test_ch.bin";
+
+// Queries, paths and tables against the reference
+void test_queries(ContractionHierarchy<long>& ch, mt19937& random, int n,
+				  const vector< vector<long> >& D,
+				  const vector< vector<long> >& W) {
+
+	int bad_distance = 0;
+	int bad_path = 0;
+	for (int q = 0; q < 300; q++) {
+
+		int s = random() % n;
+		int t = random() % n;
+
+		if (ch.query(s, t) != D[s][t])
+			bad_distance++;
+
+		if (D[s][t] == numeric_limits<long>::max())
+			continue;
+
+		// Unpacked paths are original edges of the shortest length
+		list<int> path = ch.query_path(s, t);
+		long length = 0;
+		int previous = -1;
+		for (int v : path) {
+			if (previous >= 0) {
+				if (W[previous][v] == 0)
+					bad_path++;
+				length += W[previous][v];
+			}
+			previous = v;
+		}
+		if (path.front() != s || path.back() != t || length != D[s][t])
+			bad_path++;
+	}
+	CHECK_EQUAL(0, bad_distance);
+	CHECK_EQUAL(0, bad_path);
+
+	// Bucket-based table
+	vector<int> sources;
+	vector<int> targets;
+	for (int i = 0; i < 25; i++)
+		sources.push_back(random() % n);
+	for (int j = 0; j < 40; j++)
+		targets.push_back(random() % n);
+
+	DistanceTable<long> table = ch.distance_table(sources, targets);
+	int bad = 0;
+	for (int i = 0; i < (int) sources.size(); i++)
+		for (int j = 0; j < (int) targets.size(); j++)
+			if (table.at(i, j) != D[sources[i]][targets[j]])
+				bad++;
+	CHECK_EQUAL(0, bad);
+
+}	// end - test_queries()
+
+int main() {
+
+	mt19937 random(2026);
+
+	int n = 250;
+	vector<TestEdge> edges = random_graph(random, n, 1000, 1, 30);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+
+	vector< vector<long> > W(n, vector<long>(n, 0));
+	for (auto &e : edges)
+		W[e.u][e.v] = e.weight;
+
+	// Preprocessed hierarchy
+	Graph<long> graph(GRAPH);
+	ContractionHierarchy<long> ch(graph);
+	test_queries(ch, random, n, D, W);
+
+	// Saved and loaded
+	CHECK(ch.save(HIERARCHY));
+	ContractionHierarchy<long> loaded;
+	CHECK(loaded.load(HIERARCHY));
+	CHECK_EQUAL(n, loaded.Vertices());
+	test_queries(loaded, random, n, D, W);
+
+	// Another weight type is rejected
+	ContractionHierarchy<int> narrow;
+	CHECK(!narrow.load(HIERARCHY));
+
+	// A corrupt offset is rejected and the hierarchy is kept
+	{
+		fstream data_file(HIERARCHY, ios::in | ios::out | ios::binary);
+		data_file.seekp(6 * sizeof(int) + n * sizeof(int) + 10 * sizeof(int));
+		int corrupt = 1 << 30;
+		data_file.write((const char*) &corrupt, sizeof(corrupt));
+	}
+	CHECK(!loaded.load(HIERARCHY));
+	CHECK_EQUAL(n, loaded.Vertices());
+	CHECK_EQUAL(D[1][2], loaded.query(1, 2));
+
+	remove(GRAPH.c_str());
+	remove(HIERARCHY.c_str());
+	return test_result("test_ch");
+
+}	// end - main()
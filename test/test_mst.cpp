@@ -0,0 +1,553 @@
+/*
+ * test_mst.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#include "Test.h"
+#include <algorithm>
+
+using namespace std;
+
+#include "MST.h"
+
+
+// Temporary edge file
+const string GRAPH = "test_mst.graph";
+
+// Reference union-find
+struct Sets {
+
+	vector<int> parent;
+
+	Sets(int n):parent(n) {
+		for (int i = 0; i < n; i++)
+			parent[i] = i;
+	}
+
+	int find(int v) {
+		while (parent[v] != v)
+			v = parent[v] = parent[parent[v]];
+		return v;
+	}
+
+	bool merge(int u, int v) {
+		u = find(u);
+		v = find(v);
+		if (u == v)
+			return false;
+		parent[u] = v;
+		return true;
+	}
+};
+
+// Reference Kruskal - the weights of the forest edges in merge order
+vector<long> reference_forest(int n, vector<TestEdge> edges) {
+
+	stable_sort(edges.begin(), edges.end(),
+				[](const TestEdge& a, const TestEdge& b) {
+		return a.weight < b.weight;
+	});
+
+	Sets sets(n);
+	vector<long> merges;
+	for (auto &e : edges)
+		if (sets.merge(e.u, e.v))
+			merges.push_back(e.weight);
+
+	return merges;
+
+}	// end - reference_forest()
+
+// Undirected graph with distinct vertex pairs
+vector<TestEdge> undirected_graph(mt19937& random, int n, int m, long high,
+								  int parts = 1) {
+
+	// Vertices of part p are those with v % parts == p
+	vector< vector<bool> > used(n, vector<bool>(n, false));
+	vector<TestEdge> edges;
+	while ((int) edges.size() < m) {
+		int u = random() % n;
+		int v = random() % n;
+		if (u == v || used[u][v] || u % parts != v % parts)
+			continue;
+		used[u][v] = used[v][u] = true;
+		edges.push_back(TestEdge{u, v, 1 + (long) (random() % high)});
+	}
+
+	return edges;
+
+}	// end - undirected_graph()
+
+// Symmetric matrix of the edges
+void fill_graph(Graph<long>& graph, const vector<TestEdge>& edges) {
+
+	for (auto &e : edges) {
+		graph.set_edge_value(e.u, e.v, e.weight);
+		graph.set_edge_value(e.v, e.u, e.weight);
+	}
+
+}	// end - fill_graph()
+
+// Reference spanning tree distance - infinity if the graph is disconnected
+long reference_tree(int n, const vector<TestEdge>& edges) {
+
+	vector<long> merges = reference_forest(n, edges);
+	if ((int) merges.size() != n - 1)
+		return numeric_limits<long>::max();
+
+	long distance = 0;
+	for (auto w : merges)
+		distance += w;
+
+	return distance;
+
+}	// end - reference_tree()
+
+// Heap pops in key order, with decreased keys
+void test_indexed_heap(mt19937& random, int n) {
+
+	IndexedHeap<long> heap(n);
+	vector<long> keys(n, numeric_limits<long>::max());
+
+	for (int op = 0; op < 4 * n; op++) {
+		int v = random() % n;
+		long key = random() % 1000;
+		heap.push(v, key);
+		keys[v] = min(keys[v], key);
+	}
+
+	int bad = 0;
+	long previous = numeric_limits<long>::lowest();
+	int popped = 0;
+	while (!heap.empty()) {
+		int v = heap.pop();
+		bad += keys[v] < previous || heap.contains(v);
+		previous = keys[v];
+		popped++;
+	}
+	CHECK_EQUAL(0, bad);
+	CHECK_EQUAL((int) count_if(keys.begin(), keys.end(), [](long key) {
+		return key != numeric_limits<long>::max();
+	}), popped);
+
+}	// end - test_indexed_heap()
+
+// Prim against the reference
+void test_prim(mt19937& random, int n, int m, long high, int parts) {
+
+	vector<TestEdge> edges = undirected_graph(random, n, m, high, parts);
+	Graph<long> graph(n);
+	fill_graph(graph, edges);
+
+	MST<long> prim;
+	prim.PrimMST(graph);
+	CHECK_EQUAL(reference_tree(n, edges), prim.get_mst_distance());
+
+}	// end - test_prim()
+
+// Kruskal and Filter-Kruskal against the reference
+void test_kruskal(mt19937& random, int n, int m, long high, int parts) {
+
+	vector<TestEdge> edges = undirected_graph(random, n, m, high, parts);
+	Graph<long> graph(n);
+	fill_graph(graph, edges);
+	long expected = reference_tree(n, edges);
+
+	MST<long> kruskal;
+	kruskal.KruskalMST(graph);
+	CHECK_EQUAL(expected, kruskal.get_mst_distance());
+
+	MST<long> filter;
+	filter.FilterKruskalMST(graph);
+	CHECK_EQUAL(expected, filter.get_mst_distance());
+
+}	// end - test_kruskal()
+
+// Boruvka on one and several threads against the reference
+void test_boruvka(mt19937& random, int n, int m, long high, int parts) {
+
+	vector<TestEdge> edges = undirected_graph(random, n, m, high, parts);
+	Graph<long> graph(n);
+	fill_graph(graph, edges);
+	long expected = reference_tree(n, edges);
+
+	for (int threads : {1, 4}) {
+		MST<long> boruvka;
+		boruvka.BoruvkaMST(graph, threads);
+		CHECK_EQUAL(expected, boruvka.get_mst_distance());
+	}
+
+}	// end - test_boruvka()
+
+// External Kruskal from the edge file against the reference
+void test_external(mt19937& random, int n, int m, long high, int parts) {
+
+	vector<TestEdge> edges = undirected_graph(random, n, m, high, parts);
+	write_graph(GRAPH, n, edges);
+	long expected = reference_tree(n, edges);
+
+	// In memory, then runs merged in one and in several passes
+	for (size_t run_edges : {(size_t) 1 << 20, (size_t) 97, (size_t) 3}) {
+		MST<long> external;
+		external.ExternalKruskalMST(GRAPH, false, run_edges);
+		CHECK_EQUAL(expected, external.get_mst_distance());
+	}
+
+}	// end - test_external()
+
+// Clusters, spacing and labels for a few k against the reference
+void test_dendrogram(mt19937& random, int n, int m, int parts) {
+
+	// Distinct weights, so every k has one clustering
+	vector<TestEdge> edges = undirected_graph(random, n, m, 1, parts);
+	vector<long> order(m);
+	for (int i = 0; i < m; i++)
+		order[i] = i + 1;
+	shuffle(order.begin(), order.end(), random);
+	for (int i = 0; i < m; i++)
+		edges[i].weight = order[i];
+
+	Graph<long> graph(n);
+	fill_graph(graph, edges);
+
+	vector<TestEdge> sorted = edges;
+	sort(sorted.begin(), sorted.end(), [](const TestEdge& a, const TestEdge& b) {
+		return a.weight < b.weight;
+	});
+	vector<long> merges = reference_forest(n, edges);
+	int components = n - merges.size();
+
+	Dendrogram<long> dendrogram(graph);
+	for (int k : {1, 2, 5, n / 2, n}) {
+
+		int applied = n - max(k, components);
+		CHECK_EQUAL(max(k, components), dendrogram.clusters(k));
+		long spacing = (applied < (int) merges.size())
+					   ? merges[applied] : numeric_limits<long>::max();
+		CHECK_EQUAL(spacing, dendrogram.max_spacing(k));
+		MST<long> cluster;
+		CHECK_EQUAL(spacing, cluster.k_Cluster(graph, k));
+
+		// The first merges of the reference
+		Sets sets(n);
+		for (int i = 0, done = 0; done < applied; i++)
+			done += sets.merge(sorted[i].u, sorted[i].v);
+
+		vector<int> labels = dendrogram.cluster_labels(k);
+		int bad = (int) labels.size() != n;
+		for (int u = 0; !bad && u < n; u++)
+			for (int v = u + 1; v < n; v++)
+				bad += (labels[u] == labels[v]) != (sets.find(u) == sets.find(v));
+		CHECK_EQUAL(0, bad);
+	}
+
+}	// end - test_dendrogram()
+
+// Disjoint sets against the reference
+void test_disjoint_set(mt19937& random, int n) {
+
+	DisjointSet sets(n);
+	Sets reference(n);
+
+	int bad = 0;
+	for (int op = 0; op < 5000; op++) {
+		int u = random() % n;
+		int v = random() % n;
+		bool merged = reference.merge(u, v);
+		bad += sets.merge(u, v) != merged;
+		int a = random() % n;
+		int b = random() % n;
+		bad += sets.same(a, b) != (reference.find(a) == reference.find(b));
+	}
+	CHECK_EQUAL(0, bad);
+
+	// The same merges from several threads
+	vector< pair<int, int> > pairs(n / 2);
+	for (auto &p : pairs)
+		p = make_pair((int) (random() % n), (int) (random() % n));
+
+	Sets expected(n);
+	for (auto &p : pairs)
+		expected.merge(p.first, p.second);
+
+	ConcurrentDisjointSet concurrent(n);
+	ThreadPool pool(4);
+	pool.run([&](int id) {
+		for (size_t i = id; i < pairs.size(); i += 4)
+			concurrent.merge(pairs[i].first, pairs[i].second);
+	});
+
+	bad = 0;
+	for (int q = 0; q < 5000; q++) {
+		int a = random() % n;
+		int b = random() % n;
+		bad += concurrent.same(a, b) != (expected.find(a) == expected.find(b));
+	}
+	CHECK_EQUAL(0, bad);
+
+}	// end - test_disjoint_set()
+
+// Hamming clusters against all pairs
+void test_hamming(mt19937& random, int n, int bits) {
+
+	vector<uint64_t> codes(n);
+	for (auto &code : codes)
+		code = random() & ((1ULL << bits) - 1);
+
+	HammingCluster hamming(codes, bits);
+
+	for (int d = 0; d <= 3; d++) {
+		Sets sets(n);
+		int clusters = n;
+		for (int i = 0; i < n; i++)
+			for (int j = i + 1; j < n; j++)
+				if (__builtin_popcountll(codes[i] ^ codes[j]) <= d)
+					clusters -= sets.merge(i, j);
+		CHECK_EQUAL(clusters, hamming.clusters(d));
+	}
+
+}	// end - test_hamming()
+
+// Reference minimax distance - the merge weight that first joins u and v
+long reference_bottleneck(int n, vector<TestEdge> edges, int u, int v) {
+
+	if (u == v)
+		return numeric_limits<long>::lowest();
+
+	stable_sort(edges.begin(), edges.end(),
+				[](const TestEdge& a, const TestEdge& b) {
+		return a.weight < b.weight;
+	});
+
+	Sets sets(n);
+	for (auto &e : edges) {
+		sets.merge(e.u, e.v);
+		if (sets.find(u) == sets.find(v))
+			return e.weight;
+	}
+
+	return numeric_limits<long>::max();
+
+}	// end - reference_bottleneck()
+
+// The tree of a graph, and bottlenecks against the reference
+void test_dynamic_graph(mt19937& random, int n, int m, int parts) {
+
+	vector<TestEdge> edges = undirected_graph(random, n, m, 50, parts);
+	Graph<long> graph(n);
+	fill_graph(graph, edges);
+
+	vector<long> merges = reference_forest(n, edges);
+	long forest = 0;
+	for (auto w : merges)
+		forest += w;
+
+	DynamicMST<long> dynamic(graph);
+	CHECK_EQUAL(forest, dynamic.Distance());
+	CHECK_EQUAL(n - (int) merges.size(), dynamic.Components());
+
+	int bad = 0;
+	for (int q = 0; q < 200; q++) {
+		int u = random() % n;
+		int v = random() % n;
+		long expected = reference_bottleneck(n, edges, u, v);
+		bad += dynamic.bottleneck(u, v) != expected;
+		bad += dynamic.connected(u, v) != (expected != numeric_limits<long>::max());
+	}
+	CHECK_EQUAL(0, bad);
+
+	// Out-of-range vertices are rejected
+	CHECK_EQUAL(numeric_limits<long>::max(), dynamic.bottleneck(-1, 0));
+	CHECK(!dynamic.connected(0, n));
+	dynamic.remove_edge(n, 0);
+	dynamic.set_edge(0, -1, 1);
+	CHECK_EQUAL(forest, dynamic.Distance());
+
+}	// end - test_dynamic_graph()
+
+// Edge changes against a rebuilt reference
+void test_dynamic(mt19937& random, int n) {
+
+	DynamicMST<long> dynamic(n);
+
+	vector< vector<long> > W(n, vector<long>(n, 0));
+
+	int bad = 0;
+	for (int op = 0; op < 3000; op++) {
+
+		int u = random() % n;
+		int v = random() % n;
+		if (u == v)
+			continue;
+
+		// Insert, change or remove
+		if (random() % 4 == 0) {
+			dynamic.remove_edge(u, v);
+			W[u][v] = W[v][u] = 0;
+		}
+		else {
+			long w = 1 + random() % 100;
+			dynamic.set_edge(u, v, w);
+			W[u][v] = W[v][u] = w;
+		}
+
+		if (op % 50)
+			continue;
+
+		vector<TestEdge> edges;
+		for (int i = 0; i < n; i++)
+			for (int j = i + 1; j < n; j++)
+				if (W[i][j])
+					edges.push_back(TestEdge{i, j, W[i][j]});
+
+		vector<long> merges = reference_forest(n, edges);
+		long forest = 0;
+		for (auto w : merges)
+			forest += w;
+
+		bad += dynamic.Distance() != forest;
+		bad += dynamic.Components() != n - (int) merges.size();
+	}
+	CHECK_EQUAL(0, bad);
+
+}	// end - test_dynamic()
+
+// Bottleneck queries and minimax paths
+void test_bottleneck(mt19937& random, int n, int m, int parts) {
+
+	vector<TestEdge> edges = undirected_graph(random, n, m, 50, parts);
+	Graph<long> graph(n);
+	fill_graph(graph, edges);
+
+	vector< vector<long> > W(n, vector<long>(n, 0));
+	for (auto &e : edges)
+		W[e.u][e.v] = W[e.v][e.u] = e.weight;
+
+	MSTForest<long> forest(graph);
+
+	int bad = 0;
+	for (int q = 0; q < 200; q++) {
+
+		int u = random() % n;
+		int v = random() % n;
+		long expected = reference_bottleneck(n, edges, u, v);
+
+		bad += forest.bottleneck(u, v) != expected;
+		bad += forest.connected(u, v) != (expected != numeric_limits<long>::max());
+
+		// The path is made of edges no heavier than the bottleneck
+		vector<int> path = forest.minimax_path(u, v);
+		if (expected == numeric_limits<long>::max()) {
+			bad += !path.empty();
+			continue;
+		}
+		long heaviest = numeric_limits<long>::lowest();
+		for (size_t i = 1; i < path.size(); i++) {
+			bad += W[path[i - 1]][path[i]] == 0;
+			heaviest = max(heaviest, W[path[i - 1]][path[i]]);
+		}
+		bad += path.front() != u || path.back() != v || heaviest != expected;
+	}
+	CHECK_EQUAL(0, bad);
+
+	// Out-of-range vertices are rejected
+	CHECK_EQUAL(numeric_limits<long>::max(), forest.bottleneck(-1, 0));
+	CHECK_EQUAL(-1, forest.bottleneck_edge(0, n).u);
+	CHECK(forest.minimax_path(n, 0).empty());
+	CHECK(!forest.connected(0, n));
+	CHECK_EQUAL(-1, forest.get_parent(n));
+	CHECK_EQUAL(numeric_limits<long>::max(), forest.get_weight(-1));
+
+	// Tree edges with invalid vertices are skipped
+	vector< Edge<long> > tree = {Edge<long>{5, 0, 1}, Edge<long>{7, 1, n},
+								 Edge<long>{9, -1, 2}, Edge<long>{3, 1, 2}};
+	MSTForest<long> given(n, tree);
+	CHECK_EQUAL(5L, given.bottleneck(0, 2));
+	CHECK(!given.connected(0, n - 1));
+
+}	// end - test_bottleneck()
+
+// Spanning forest of every component against the reference
+void test_forest(mt19937& random, int n, int m, long high, int parts) {
+
+	vector<TestEdge> edges = undirected_graph(random, n, m, high, parts);
+	Graph<long> graph(n);
+	fill_graph(graph, edges);
+
+	vector<long> merges = reference_forest(n, edges);
+	long forest = 0;
+	for (auto w : merges)
+		forest += w;
+
+	for (int threads : {1, 4}) {
+
+		MST<long> mst;
+		SpanningForest<long> spanning = mst.ForestMST(graph, threads);
+		CHECK_EQUAL(forest, spanning.total());
+		CHECK_EQUAL(forest, mst.get_mst_distance());
+		CHECK_EQUAL(n - (int) merges.size(), spanning.Components());
+
+		// Each tree spans its component
+		int bad = 0;
+		int vertices = 0;
+		for (int c = 0; c < spanning.Components(); c++) {
+			long distance = 0;
+			for (auto &e : spanning.edges(c)) {
+				distance += e.weight;
+				bad += spanning.component(e.u) != c || spanning.component(e.v) != c;
+			}
+			bad += distance != spanning.distance(c);
+			bad += (int) spanning.edges(c).size() != spanning.size(c) - 1;
+			vertices += spanning.size(c);
+		}
+		CHECK_EQUAL(0, bad);
+		CHECK_EQUAL(n, vertices);
+	}
+
+}	// end - test_forest()
+
+int main() {
+
+	mt19937 random(2026);
+
+	test_indexed_heap(random, 500);
+	test_prim(random, 60, 400, 20, 1);
+	test_prim(random, 200, 2000, 1000, 1);
+	test_prim(random, 90, 500, 30, 3);
+
+	test_kruskal(random, 60, 400, 20, 1);
+	test_kruskal(random, 200, 2000, 1000, 1);
+	test_kruskal(random, 90, 500, 30, 3);
+
+	// Connected, and split into 3 components
+	test_boruvka(random, 60, 400, 20, 1);
+	test_boruvka(random, 200, 2000, 1000, 1);
+	test_boruvka(random, 90, 500, 30, 3);
+
+	test_external(random, 60, 400, 20, 1);
+	test_external(random, 90, 500, 30, 3);
+
+	test_dendrogram(random, 60, 400, 1);
+	test_dendrogram(random, 90, 500, 3);
+
+	test_disjoint_set(random, 500);
+
+	test_hamming(random, 300, 12);
+
+	test_dynamic_graph(random, 120, 500, 1);
+	test_dynamic_graph(random, 120, 400, 2);
+	test_dynamic(random, 40);
+	test_dynamic(random, 200);
+
+	test_bottleneck(random, 120, 500, 1);
+	test_bottleneck(random, 120, 400, 2);
+
+	test_forest(random, 60, 400, 20, 1);
+	test_forest(random, 90, 500, 30, 3);
+
+	remove(GRAPH.c_str());
+	return test_result("test_mst");
+
+}	// end - main()
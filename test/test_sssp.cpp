@@ -0,0 +1,480 @@
+/*
+ * test_sssp.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Shawn Flynn
+ */
+
+#include "Test.h"
+#include <algorithm>
+#include <sstream>
+
+using namespace std;
+
+#include "ShortestPath.h"
+
+
+// Temporary graph file
+const string GRAPH = "test_sssp.graph";
+
+// Infinity
+const long infinity = numeric_limits<long>::max();
+
+// Edge weight lookup, 0 = no edge
+vector< vector<long> > weights(int n, const vector<TestEdge>& edges) {
+
+	vector< vector<long> > W(n, vector<long>(n, 0));
+	for (auto &e : edges)
+		W[e.u][e.v] = e.weight;
+
+	return W;
+
+}	// end - weights()
+
+// True if the path is a real s -> t path of the given length
+// An unreachable target has an empty path
+bool valid_path(const vector< vector<long> >& W, const list<int>& path,
+				int s, int t, long distance) {
+
+	if (distance == infinity)
+		return path.empty();
+	if (path.empty() || path.front() != s || path.back() != t)
+		return false;
+
+	long length = 0;
+	int previous = -1;
+	for (int v : path) {
+		if (previous >= 0) {
+			if (W[previous][v] == 0)
+				return false;
+			length += W[previous][v];
+		}
+		previous = v;
+	}
+
+	return length == distance;
+
+}	// end - valid_path()
+
+// One-to-all trees, point distances and paths against the reference
+void test_source_tree(mt19937& random, int n, int m) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 40);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+	vector< vector<long> > W = weights(n, edges);
+
+	ShortestPath<long> sp(GRAPH);
+
+	int bad = 0;
+	for (int q = 0; q < 20; q++) {
+
+		int s = random() % n;
+		SSSPTree<long> tree = sp.getSingleSource(s);
+		bad += tree.Source() != s || tree.Vertices() != n;
+
+		for (int v = 0; v < n; v++) {
+			bad += tree.distance(v) != D[s][v];
+			bad += tree.reachable(v) != (D[s][v] != infinity);
+			bad += !valid_path(W, tree.path(v), s, v, D[s][v]);
+		}
+	}
+	CHECK_EQUAL(0, bad);
+
+	bad = 0;
+	for (int q = 0; q < 200; q++) {
+		int s = random() % n;
+		int t = random() % n;
+		bad += sp.getDistance(s, t) != D[s][t];
+		bad += !valid_path(W, sp.getPath(s, t), s, t, D[s][t]);
+	}
+	CHECK_EQUAL(0, bad);
+
+	// Invalid sources
+	CHECK_EQUAL(infinity, sp.getDistance(-1, 0));
+	CHECK(sp.getPath(n, 0).empty());
+	CHECK_EQUAL(0, sp.getSingleSource(n).Vertices());
+
+}	// end - test_source_tree()
+
+// Path printed by print_ShortestPath - "a -> b -> c = d"
+list<int> printed_path(ShortestPath<long>& sp, Graph<long>& graph) {
+
+	stringstream out;
+	streambuf* saved = cout.rdbuf(out.rdbuf());
+	sp.print_ShortestPath(graph);
+	cout.rdbuf(saved);
+
+	list<int> path;
+	string line;
+	getline(out, line);
+	getline(out, line);
+	stringstream nodes(line);
+	string token;
+	while (nodes >> token && token != "=")
+		if (token != "->")
+			path.push_back(stoi(token));
+
+	return path;
+
+}	// end - printed_path()
+
+// Many dense queries through the per-thread workspace
+void test_workspace(mt19937& random, int n, int m) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 40);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+	vector< vector<long> > W = weights(n, edges);
+
+	Graph<long> graph(GRAPH);
+	ShortestPath<long> sp(GRAPH);
+
+	int bad = 0;
+	for (int q = 0; q < 300; q++) {
+
+		int s = random() % n;
+		int t = random() % n;
+		if (s == t)
+			continue;
+
+		// Unreachable reads as 0
+		sp.getShortestPath(graph, s, t);
+		long expected = (D[s][t] == infinity) ? 0 : D[s][t];
+		bad += sp.getShortestPathDistance() != expected;
+		bad += !valid_path(W, printed_path(sp, graph), s, t, D[s][t]);
+	}
+	CHECK_EQUAL(0, bad);
+
+	// Everything reachable from vertex 0
+	bool connected = true;
+	for (int v = 0; v < n; v++)
+		connected = connected && D[0][v] != infinity;
+	CHECK_EQUAL(connected, graph.is_connected());
+
+}	// end - test_workspace()
+
+// Cached trees give the uncached answers, and edge changes invalidate them
+void test_cache(mt19937& random, int n, int m) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 40);
+	write_graph(GRAPH, n, edges);
+
+	ShortestPath<long> cached(GRAPH);
+	cached.enableCache(1 << 20);
+
+	// A budget too small for any tree still answers
+	ShortestPath<long> tiny(GRAPH);
+	tiny.enableCache(1);
+
+	vector< vector<long> > W = weights(n, edges);
+
+	for (int round = 0; round < 4; round++) {
+
+		vector<TestEdge> current;
+		for (int u = 0; u < n; u++)
+			for (int v = 0; v < n; v++)
+				if (W[u][v])
+					current.push_back(TestEdge{u, v, W[u][v]});
+
+		vector< vector<long> > D;
+		CHECK(reference_apsp(n, current, D));
+
+		// A few hot sources
+		int bad = 0;
+		for (int q = 0; q < 300; q++) {
+			int s = random() % 8;
+			int t = random() % n;
+			bad += cached.getDistance(s, t) != D[s][t];
+			bad += tiny.getDistance(s, t) != D[s][t];
+			bad += !valid_path(W, cached.getPath(s, t), s, t, D[s][t]);
+		}
+		CHECK_EQUAL(0, bad);
+
+		// Change a few edges
+		for (int c = 0; c < 5; c++) {
+			int u = random() % 8;
+			int v = random() % n;
+			if (u == v)
+				continue;
+			long w = 1 + random() % 40;
+			cached.set_edge_value(u, v, w);
+			tiny.set_edge_value(u, v, w);
+			W[u][v] = w;
+		}
+	}
+
+}	// end - test_cache()
+
+// Many-to-many tables against the reference
+void test_table(mt19937& random, int n, int m) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 40);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+
+	ShortestPath<long> sp(GRAPH);
+
+	// Repeated targets share a vertex
+	vector<int> sources;
+	vector<int> targets;
+	for (int i = 0; i < 70; i++)
+		sources.push_back(random() % n);
+	for (int j = 0; j < 30; j++)
+		targets.push_back(random() % n);
+	targets.push_back(targets[0]);
+
+	for (int threads : {1, 4}) {
+		sp.setThreads(threads);
+		DistanceTable<long> table = sp.distance_table(sources, targets);
+		int bad = 0;
+		for (int i = 0; i < (int) sources.size(); i++)
+			for (int j = 0; j < (int) targets.size(); j++)
+				bad += table.at(i, j) != D[sources[i]][targets[j]];
+		CHECK_EQUAL(0, bad);
+	}
+
+	// An invalid vertex leaves the table unreachable
+	DistanceTable<long> invalid = sp.distance_table(vector<int>(1, 0),
+													vector<int>(1, n));
+	CHECK_EQUAL(infinity, invalid.at(0, 0));
+
+}	// end - test_table()
+
+// Unit weights search breadth-first
+void test_unit_weights(mt19937& random, int n, int m) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 1);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+	vector< vector<long> > W = weights(n, edges);
+
+	ShortestPath<long> sp(GRAPH);
+	CHECK(sp.getUnitWeights() == false);
+
+	int bad = 0;
+	for (int q = 0; q < 200; q++) {
+		int s = random() % n;
+		int t = random() % n;
+		bad += sp.getDistance(s, t) != D[s][t];
+		bad += !valid_path(W, sp.getPath(s, t), s, t, D[s][t]);
+	}
+	CHECK_EQUAL(0, bad);
+
+	// More than one 64-source batch
+	vector<int> sources;
+	vector<int> targets;
+	for (int i = 0; i < 70; i++)
+		sources.push_back(random() % n);
+	for (int j = 0; j < 30; j++)
+		targets.push_back(random() % n);
+
+	for (int threads : {1, 4}) {
+		sp.setThreads(threads);
+		DistanceTable<long> table = sp.distance_table(sources, targets);
+		bad = 0;
+		for (int i = 0; i < (int) sources.size(); i++)
+			for (int j = 0; j < (int) targets.size(); j++)
+				bad += table.at(i, j) != D[sources[i]][targets[j]];
+		CHECK_EQUAL(0, bad);
+	}
+
+	// Forced unit weights count the hops of a weighted graph
+	vector<TestEdge> weighted = random_graph(random, n, m, 1, 40);
+	write_graph(GRAPH, n, weighted);
+	for (auto &e : weighted)
+		e.weight = 1;
+	CHECK(reference_apsp(n, weighted, D));
+
+	ShortestPath<long> hops(GRAPH);
+	hops.setUnitWeights(true);
+	bad = 0;
+	for (int q = 0; q < 200; q++) {
+		int s = random() % n;
+		int t = random() % n;
+		bad += hops.getDistance(s, t) != D[s][t];
+	}
+	CHECK_EQUAL(0, bad);
+
+}	// end - test_unit_weights()
+
+// Radius and k-nearest queries against the reference
+void test_radius(mt19937& random, int n, int m, long shift, bool cache) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 40, shift);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+
+	ShortestPath<long> sp(GRAPH);
+	if (cache)
+		sp.enableCache(1 << 20);
+
+	for (int q = 0; q < 20; q++) {
+
+		int s = random() % n;
+
+		// Everything within the radius, and nothing else
+		long radius = 1 - shift + (long) (random() % (3 * (40 + shift)));
+		vector< pair<int, long> > expected;
+		for (int v = 0; v < n; v++)
+			if (D[s][v] <= radius)
+				expected.push_back(make_pair(v, D[s][v]));
+		vector< pair<int, long> > found = sp.within_radius(s, radius);
+		sort(found.begin(), found.end());
+		CHECK(found == expected);
+
+		// The k nearest even vertices - compare the distances
+		int k = 1 + random() % 10;
+		vector<long> nearest;
+		for (int v = 0; v < n; v++)
+			if (v % 2 == 0 && D[s][v] != infinity)
+				nearest.push_back(D[s][v]);
+		sort(nearest.begin(), nearest.end());
+		if ((int) nearest.size() > k)
+			nearest.resize(k);
+
+		vector<long> got;
+		for (auto &p : sp.k_nearest(s, k, [](int v) { return v % 2 == 0; }))
+			got.push_back(p.second);
+		sort(got.begin(), got.end());
+		CHECK(got == nearest);
+	}
+
+}	// end - test_radius()
+
+// Negative edges - potentials on demand, negative cycles rejected
+void test_negative(mt19937& random, int n, int m) {
+
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 20, 30);
+	write_graph(GRAPH, n, edges);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+
+	// Both constructors search the reweighted graph
+	ShortestPath<long> dense(GRAPH);
+	ShortestPath<long> johnson(GRAPH, "Johnson");
+	int bad = 0;
+	for (int q = 0; q < 100; q++) {
+		int s = random() % n;
+		int t = random() % n;
+		bad += dense.getDistance(s, t) != D[s][t];
+		bad += johnson.getDistance(s, t) != D[s][t];
+	}
+	CHECK_EQUAL(0, bad);
+
+	// Close a cycle of weight 1 - still no negative cycle
+	int u = -1;
+	int v = -1;
+	for (int i = 0; i < n && u < 0; i++)
+		for (int j = 0; j < n; j++)
+			if (i != j && D[j][i] != infinity && D[j][i] < -1) {
+				u = i;
+				v = j;
+				break;
+			}
+	CHECK(u >= 0);
+	if (u < 0)
+		return;
+
+	dense.set_edge_value(u, v, 1 - D[v][u]);
+	edges.push_back(TestEdge{u, v, 1 - D[v][u]});
+	CHECK(reference_apsp(n, edges, D));
+
+	bad = 0;
+	for (int q = 0; q < 100; q++) {
+		int s = random() % n;
+		int t = random() % n;
+		bad += dense.getDistance(s, t) != D[s][t];
+	}
+	CHECK_EQUAL(0, bad);
+
+	// Weight -1 closes a negative cycle
+	dense.set_edge_value(u, v, -1 - D[v][u]);
+	CHECK_EQUAL(infinity, dense.getDistance(u, v));
+	CHECK(dense.getPath(u, v).empty());
+	CHECK(dense.within_radius(u, 100).empty());
+	CHECK(dense.k_nearest(u, 3, [](int) { return true; }).empty());
+	DistanceTable<long> table = dense.distance_table(vector<int>(1, u),
+													 vector<int>(1, v));
+	CHECK_EQUAL(infinity, table.at(0, 0));
+
+}	// end - test_negative()
+
+// Potentials from a query on one graph don't leak into a search of another
+void test_stale_potentials(mt19937& random, int n, int m) {
+
+	vector<TestEdge> negative = random_graph(random, n, m, 1, 20, 30);
+	write_graph(GRAPH, n, negative);
+
+	// k_nearest computes the potentials of the negative graph
+	ShortestPath<long> sp(GRAPH);
+	sp.k_nearest(0, 3, [](int) { return true; });
+
+	// A non-negative graph of the same size
+	vector<TestEdge> edges = random_graph(random, n, m, 1, 40);
+	Graph<long> graph(n);
+	for (auto &e : edges)
+		graph.set_edge_value(e.u, e.v, e.weight);
+
+	vector< vector<long> > D;
+	CHECK(reference_apsp(n, edges, D));
+	vector< vector<long> > W = weights(n, edges);
+
+	int bad = 0;
+	for (int q = 0; q < 50; q++) {
+
+		int s = random() % n;
+		int t = random() % n;
+		if (s == t)
+			continue;
+
+		sp.getShortestPath(graph, s, t);
+		long expected = (D[s][t] == infinity) ? 0 : D[s][t];
+		bad += sp.getShortestPathDistance() != expected;
+		bad += !valid_path(W, printed_path(sp, graph), s, t, D[s][t]);
+	}
+	CHECK_EQUAL(0, bad);
+
+}	// end - test_stale_potentials()
+
+int main() {
+
+	mt19937 random(2026);
+
+	test_source_tree(random, 80, 400);
+	test_source_tree(random, 150, 700);
+
+	test_workspace(random, 60, 300);
+	test_workspace(random, 60, 90);
+
+	test_cache(random, 100, 500);
+
+	test_table(random, 80, 400);
+	test_table(random, 200, 800);
+
+	test_unit_weights(random, 200, 800);
+	test_unit_weights(random, 120, 300);
+
+	// Non-negative, then negative edges without negative cycles
+	test_radius(random, 80, 400, 0, false);
+	test_radius(random, 150, 700, 0, true);
+	test_radius(random, 90, 450, 25, false);
+	test_radius(random, 90, 450, 25, true);
+	test_negative(random, 60, 300);
+	test_stale_potentials(random, 60, 300);
+
+	remove(GRAPH.c_str());
+	return test_result("test_sssp");
+
+}	// end - main()